@@ -0,0 +1,36 @@
+/**
+ * \file quantity_io.cpp
+ *
+ * \brief   Compiled IO of the quantity library.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compile this file with the same PHYS_UNITS_REP_TYPE and the same other
+ * macros as the code that uses it, and use it by compiling that code with
+ * PHYS_UNITS_IO_LIBRARY defined. The definitions below give the non-inline
+ * functions of the IO headers, and the extern template declarations of the
+ * headers become the explicit instantiations of PHYS_UNITS_IO_DIMENSIONS.
+ */
+
+#ifndef PHYS_UNITS_IO_LIBRARY
+# define PHYS_UNITS_IO_LIBRARY
+#endif
+
+#define PHYS_UNITS_IO_SOURCE
+
+#include <ostream>
+
+#include "phys/units/io.hpp"
+
+/*
+ * end of file
+ */
@@ -0,0 +1,38 @@
+/**
+ * \file phys.units-core.cppm
+ *
+ * \brief   Module partition phys.units:core: quantities, dimensions, SI units and literals.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * The partitions export the declarations of the headers unchanged: the
+ * standard headers go into the global module fragment and the library
+ * header is included in an export block, where the include guards of the
+ * standard headers keep them out of the module purview.
+ */
+
+module;
+
+#include <cmath>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+export module phys.units:core;
+
+export {
+#include "phys/units/quantity.hpp"
+}
+
+/*
+ * end of file
+ */
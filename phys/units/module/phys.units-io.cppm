@@ -0,0 +1,56 @@
+/**
+ * \file phys.units-io.cppm
+ *
+ * \brief   Module partition phys.units:io: unit names and symbols, and text output, also in engineering notation.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+module;
+
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iosfwd>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+export module phys.units:io;
+
+import :core;
+
+/*
+ * macros do not travel with an import, so define them here; the declarations
+ * of quantity.hpp come from :core, so skip the header itself.
+ */
+#include "phys/units/quantity_macros.hpp"
+#define PHYS_UNITS_QUANTITY_HPP_INCLUDED
+
+/*
+ * quantity_io_engineering.hpp is part of this partition, as it uses
+ * std::string as well (see phys.units.cppm).
+ */
+export {
+#include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_io_symbols.hpp"
+#include "phys/units/quantity_io_engineering.hpp"
+}
+
+/*
+ * end of file
+ */
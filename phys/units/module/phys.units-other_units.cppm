@@ -0,0 +1,29 @@
+/**
+ * \file phys.units-other_units.cppm
+ *
+ * \brief   Module partition phys.units:other_units: units not approved for use with SI.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+export module phys.units:other_units;
+
+import :core;
+
+#include "phys/units/quantity_macros.hpp"
+#define PHYS_UNITS_QUANTITY_HPP_INCLUDED
+
+export {
+#include "phys/units/other_units.hpp"
+}
+
+/*
+ * end of file
+ */
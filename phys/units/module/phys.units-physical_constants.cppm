@@ -0,0 +1,29 @@
+/**
+ * \file phys.units-physical_constants.cppm
+ *
+ * \brief   Module partition phys.units:physical_constants: several physical constants.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+export module phys.units:physical_constants;
+
+import :core;
+
+#include "phys/units/quantity_macros.hpp"
+#define PHYS_UNITS_QUANTITY_HPP_INCLUDED
+
+export {
+#include "phys/units/physical_constants.hpp"
+}
+
+/*
+ * end of file
+ */
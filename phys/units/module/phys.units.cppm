@@ -0,0 +1,52 @@
+/**
+ * \file phys.units.cppm
+ *
+ * \brief   Primary module interface of phys.units, alongside the headers.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * import phys.units; gives the declarations of quantity.hpp, io.hpp,
+ * other_units.hpp and physical_constants.hpp. The macros of the headers,
+ * such as PHYS_UNITS_REP_TYPE and QUANTITY_USE_KELVIN, take effect when the
+ * module is built, not when it is imported.
+ *
+ * The global module fragment repeats the standard headers of the partitions:
+ * without it, g++ 12 attaches the standard declarations that the partitions
+ * instantiate to this module and an importer fails to find their members.
+ * It leaves out the headers that declare std::string (<iosfwd>, <stdexcept>,
+ * <string> and <system_error>), which only :io includes: with std::string in
+ * more than one module unit, g++ 12 fails to compile an importer that
+ * destroys a string returned by the module.
+ */
+
+module;
+
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+export module phys.units;
+
+export import :core;
+export import :io;
+export import :other_units;
+export import :physical_constants;
+
+/*
+ * end of file
+ */
@@ -31,8 +31,11 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <type_traits>
 #include <utility>  // std::declval
 
+#include "phys/units/quantity_fwd.hpp"
+
 /// namespace phys.
 
 namespace phys {
@@ -41,22 +44,128 @@ namespace phys {
 
 namespace units {
 
-#ifdef PHYS_UNITS_REP_TYPE
-   using Rep = PHYS_UNITS_REP_TYPE;
+/// namespace promotion.
+
+namespace promotion {
+
+/*
+ * Policies for the magnitude type of the result of mixed-type arithmetic;
+ * X is the magnitude type of the quantity, or of the left quantity.
+ * Select one with PHYS_UNITS_PROMOTION_POLICY, e.g. -DPHYS_UNITS_PROMOTION_POLICY=keep_left.
+ */
+
+/**
+ * the type of the built-in operation, e.g. float * long double gives long double.
+ */
+struct natural
+{
+    template< typename X, typename Y >
+    using add = decltype( std::declval<X>() + std::declval<Y>() );
+
+    template< typename X, typename Y >
+    using mul = decltype( std::declval<X>() * std::declval<Y>() );
+};
+
+/**
+ * the magnitude type of the (left) quantity, e.g. float * long double gives float.
+ */
+struct keep_left
+{
+    template< typename X, typename Y >
+    using add = X;
+
+    template< typename X, typename Y >
+    using mul = X;
+};
+
+/**
+ * the type of the built-in operation, but a floating point type
+ * no wider than Rep, e.g. float * long double gives double.
+ */
+struct at_most_rep
+{
+    template< typename T >
+    using narrow = typename std::conditional<
+        std::is_floating_point<T>::value && ( sizeof( T ) > sizeof( Rep ) ), Rep, T >::type;
+
+    template< typename X, typename Y >
+    using add = narrow< natural::add<X, Y> >;
+
+    template< typename X, typename Y >
+    using mul = narrow< natural::mul<X, Y> >;
+};
+
+} // namespace promotion
+
+#ifdef PHYS_UNITS_PROMOTION_POLICY
+   using Promotion = promotion::PHYS_UNITS_PROMOTION_POLICY;
 #else
-   using Rep = double;
+   using Promotion = promotion::natural;
 #endif
 
-/*
- * declare now, define later.
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+
+/// namespace detail.
+
+namespace detail {
+
+constexpr int lowest_dimension( dimension_code const code )
+{
+    return int( ( code % dimension_radix + dimension_radix + dimension_radix / 2 ) % dimension_radix - dimension_radix / 2 );
+}
+
+constexpr int decode_dimension( dimension_code const code, int const i )
+{
+    return i == 0 ? lowest_dimension( code )
+                  : decode_dimension( ( code - lowest_dimension( code ) ) / dimension_radix, i - 1 );
+}
+
+} // namespace detail
+
+/**
+ * The seven exponents packed into a single template argument, for short
+ * mangled names; spell them as dimensions<...>, which is an alias for it.
  */
-template< typename Dims, typename T = Rep >
-class quantity;
+template< detail::dimension_code Code >
+struct packed_dimensions
+{
+    enum
+    {
+        dim1 = detail::decode_dimension( Code, 0 ),
+        dim2 = detail::decode_dimension( Code, 1 ),
+        dim3 = detail::decode_dimension( Code, 2 ),
+        dim4 = detail::decode_dimension( Code, 3 ),
+        dim5 = detail::decode_dimension( Code, 4 ),
+        dim6 = detail::decode_dimension( Code, 5 ),
+        dim7 = detail::decode_dimension( Code, 6 ),
+
+        is_all_zero = Code == 0,
+
+        is_base =
+            1 == (dim1 != 0) + (dim2 != 0) + (dim3 != 0) + (dim4 != 0) + (dim5 != 0) + (dim6 != 0) + (dim7 != 0)  &&
+            1 ==  dim1 + dim2 + dim3 + dim4 + dim5 + dim6 + dim7,
+    };
+};
+
+template< detail::dimension_code X, detail::dimension_code Y >
+constexpr bool operator==( packed_dimensions<X> const &, packed_dimensions<Y> const & )
+{
+    return X == Y;
+}
+
+template< detail::dimension_code X, detail::dimension_code Y >
+constexpr bool operator!=( packed_dimensions<X> const &, packed_dimensions<Y> const & )
+{
+    return X != Y;
+}
+
+#else // PHYS_UNITS_PACKED_DIMENSIONS
 
 /**
  * We could drag dimensions around individually, but it's much more convenient to package them.
+ * The default arguments of D4 to D7 are in quantity_fwd.hpp.
  */
-template< int D1, int D2, int D3, int D4 = 0, int D5 = 0, int D6 = 0, int D7 = 0 >
+template< int D1, int D2, int D3, int D4, int D5, int D6, int D7 >
 struct dimensions
 {
     enum
@@ -76,82 +185,318 @@ struct dimensions
             1 == (D1 != 0) + (D2 != 0) + (D3 != 0) + (D4 != 0) + (D5 != 0) + (D6 != 0) + (D7 != 0)  &&
             1 ==  D1 + D2 + D3 + D4 + D5 + D6 + D7,
     };
+};
 
-    template< int R1, int R2, int R3, int R4, int R5, int R6, int R7 >
-    constexpr bool operator==( dimensions<R1, R2, R3, R4, R5, R6, R7> const & ) const
-    {
-        return D1==R1 && D2==R2 && D3==R3 && D4==R4 && D5==R5 && D6==R6 && D7==R7;
-    }
+/**
+ * dimensions compare equal if they are the same type; the comparisons
+ * are free functions, so that they are not instantiated with each dimensions.
+ */
+template< int... X, int... Y >
+constexpr bool operator==( dimensions<X...> const &, dimensions<Y...> const & )
+{
+    return std::is_same< dimensions<X...>, dimensions<Y...> >::value;
+}
 
-    template< int R1, int R2, int R3, int R4, int R5, int R6, int R7 >
-    constexpr bool operator!=( dimensions<R1, R2, R3, R4, R5, R6, R7> const & rhs ) const
-    {
-        return !( *this == rhs );
-    }
-};
+template< int... X, int... Y >
+constexpr bool operator!=( dimensions<X...> const & x, dimensions<Y...> const & y )
+{
+    return !( x == y );
+}
 
-/// demensionless 'dimension'.
+#endif // PHYS_UNITS_PACKED_DIMENSIONS
 
-typedef dimensions< 0, 0, 0 > dimensionless_d;
+/**
+ * tag to construct a quantity without initializing its magnitude,
+ * e.g. for a large buffer that is overwritten next; see no_init_allocator.
+ */
+PHYS_UNITS_CONSTANT struct no_init_t{} no_init{};
 
 /// namespace detail.
 
 namespace detail {
 
+/**
+ * tag to construct a quantity from a magnitude.
+ */
+PHYS_UNITS_CONSTANT struct magnitude_tag_t{} magnitude_tag{};
+
 /**
  * \brief The "collapse" template is used to avoid quantity< dimensions< 0, 0, 0 > >,
  * i.e. to make dimensionless results come out as type "Rep".
+ * It is instantiated once per dimension; the result for a magnitude type
+ * is an alias, which the compiler does not instantiate.
  */
-template< typename D, typename T >
-struct collapse
+template< typename D >
+struct collapse_to
 {
-    typedef quantity< D, T > type;
+    template< typename T >
+    using type = quantity< D, T >;
 };
 
-template< typename T >
-struct collapse< dimensionless_d, T >
+template<>
+struct collapse_to< dimensionless_d >
 {
-    typedef T type;
+    template< typename T >
+    using type = T;
 };
 
 template< typename D, typename T >
-using Collapse = typename collapse<D,T>::type;
+using Collapse = typename collapse_to<D>::template type<T>;
 
-// promote types of expression to result type.
+template< typename D, typename T >
+struct collapse
+{
+    typedef Collapse< D, T > type;
+};
+
+// promote types of expression to result type, according to the
+// promotion policy; X is the magnitude type of the (left) quantity.
 
 template < typename X, typename Y >
-using PromoteAdd = decltype( std::declval<X>() + std::declval<Y>() );
+using PromoteAdd = Promotion::add<X, Y>;
 
 template < typename X, typename Y >
-using PromoteMul = decltype( std::declval<X>() * std::declval<Y>() );
+using PromoteMul = Promotion::mul<X, Y>;
+
+/**
+ * trait to identify containers of quantities, see quantity_array.hpp;
+ * containers are not accepted as the number operand of quantity operators.
+ */
+template< typename T >
+struct is_quantity_range : std::false_type { };
+
+/**
+ * trait to identify quantities.
+ */
+template< typename T >
+struct is_quantity : std::false_type { };
+
+#ifndef PHYS_UNITS_ERASED
+template< typename D, typename T >
+struct is_quantity< quantity<D, T> > : std::true_type { };
+#endif
+
+/**
+ * trait to identify quantities of any kind; scaled_quantity.hpp and
+ * unit_system.hpp add their quantity types.
+ */
+template< typename T >
+struct is_quantity_kind : is_quantity<T> { };
+
+/**
+ * a number operand of quantity operators is neither a quantity of any kind
+ * nor a container, but may be a user-defined number such as a fixed-point
+ * type; use as default template argument, so that a quantity or a container
+ * is rejected before the result type is computed, or with R as return type.
+ */
+template< typename Y, typename R = void >
+using EnableIfScalar = typename std::enable_if< !is_quantity_kind<Y>::value && !is_quantity_range<Y>::value, R >::type;
+
+/**
+ * only built-in numbers, e.g. for the std:: math functions.
+ */
+template< typename Y, typename R >
+using EnableIfNumber = typename std::enable_if< std::is_arithmetic<Y>::value, R >::type;
+
+/**
+ * the dimensions of the result of a quantity operation.
+ */
+template< typename Q >
+struct dimensions_of
+{
+    typedef dimensionless_d type;
+};
+
+#ifndef PHYS_UNITS_ERASED
+template< typename D, typename T >
+struct dimensions_of< quantity<D, T> >
+{
+    typedef D type;
+};
+#endif
+
+template< typename Q >
+using DimensionsOf = typename dimensions_of<Q>::type;
 
 /*
  * The following batch of structs are type generators to calculate
  * the correct type of the result of various operations.
+ *
+ * The dimension arithmetic is done once per combination of dimensions by
+ * the *_dims structs, on the packs of exponents, independent of the
+ * magnitude type; the aliases Product etc. add the magnitude type.
  */
 
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+
+/**
+ * whether the exponents of code X + Sign * Y remain in range.
+ */
+constexpr bool dimensions_fit( dimension_code const x, dimension_code const y, int const sign, int const i = 0 )
+{
+    return i == 7 || (
+        decode_dimension( x, i ) + sign * decode_dimension( y, i ) <  dimension_radix / 2 &&
+        decode_dimension( x, i ) + sign * decode_dimension( y, i ) >= -dimension_radix / 2 &&
+        dimensions_fit( x, y, sign, i + 1 ) );
+}
+
+constexpr bool dimensions_scale_fit( dimension_code const x, int const n, int const i = 0 )
+{
+    return i == 7 || (
+        decode_dimension( x, i ) * n <  dimension_radix / 2 &&
+        decode_dimension( x, i ) * n >= -dimension_radix / 2 &&
+        dimensions_scale_fit( x, n, i + 1 ) );
+}
+
+constexpr bool dimensions_divisible( dimension_code const x, int const n, int const i = 0 )
+{
+    return i == 7 || ( decode_dimension( x, i ) % n == 0 && dimensions_divisible( x, n, i + 1 ) );
+}
+
+template< typename DX, typename DY >
+struct product_dims;
+
+template< dimension_code X, dimension_code Y >
+struct product_dims< packed_dimensions<X>, packed_dimensions<Y> >
+{
+    static_assert( dimensions_fit( X, Y, +1 ), "packed dimension exponents must be in [-128, 127]" );
+
+    typedef packed_dimensions< X + Y > type;
+};
+
+template< typename DX, typename DY >
+struct quotient_dims;
+
+template< dimension_code X, dimension_code Y >
+struct quotient_dims< packed_dimensions<X>, packed_dimensions<Y> >
+{
+    static_assert( dimensions_fit( X, Y, -1 ), "packed dimension exponents must be in [-128, 127]" );
+
+    typedef packed_dimensions< X - Y > type;
+};
+
+template< typename D >
+struct reciprocal_dims;
+
+template< dimension_code X >
+struct reciprocal_dims< packed_dimensions<X> >
+{
+    static_assert( dimensions_fit( 0, X, -1 ), "packed dimension exponents must be in [-128, 127]" );
+
+    typedef packed_dimensions< -X > type;
+};
+
+template< typename D, int N >
+struct power_dims;
+
+template< dimension_code X, int N >
+struct power_dims< packed_dimensions<X>, N >
+{
+    static_assert( dimensions_scale_fit( X, N ), "packed dimension exponents must be in [-128, 127]" );
+
+    typedef packed_dimensions< N * X > type;
+};
+
+template< typename D, int N >
+struct root_dims;
+
+template< dimension_code X, int N >
+struct root_dims< packed_dimensions<X>, N >
+{
+    typedef packed_dimensions< X / N > type;
+
+    enum { all_even_multiples = dimensions_divisible( X, N ) };
+};
+
+template< typename DX, typename DY >
+using ProductDims = typename product_dims<DX, DY>::type;
+
+template< typename DX, typename DY >
+using QuotientDims = typename quotient_dims<DX, DY>::type;
+
+#else // PHYS_UNITS_PACKED_DIMENSIONS
+
+/**
+ * dimensions of a product.
+ */
+template< typename DX, typename DY >
+struct product_dims;
+
+template< int... X, int... Y >
+struct product_dims< dimensions<X...>, dimensions<Y...> >
+{
+    typedef dimensions< ( X + Y )... > type;
+};
+
+template< typename DX, typename DY >
+using ProductDims = typename product_dims<DX, DY>::type;
+
+/**
+ * dimensions of a quotient.
+ */
+template< typename DX, typename DY >
+struct quotient_dims;
+
+template< int... X, int... Y >
+struct quotient_dims< dimensions<X...>, dimensions<Y...> >
+{
+    typedef dimensions< ( X - Y )... > type;
+};
+
+template< typename DX, typename DY >
+using QuotientDims = typename quotient_dims<DX, DY>::type;
+
+/**
+ * dimensions of a reciprocal.
+ */
+template< typename D >
+struct reciprocal_dims;
+
+template< int... X >
+struct reciprocal_dims< dimensions<X...> >
+{
+    typedef dimensions< ( -X )... > type;
+};
+
+/**
+ * dimensions of an N-th power.
+ */
+template< typename D, int N >
+struct power_dims;
+
+template< int... X, int N >
+struct power_dims< dimensions<X...>, N >
+{
+    typedef dimensions< ( N * X )... > type;
+};
+
+/**
+ * dimensions of an N-th root, and whether they are integral.
+ */
+template< typename D, int N >
+struct root_dims;
+
+template< int... X, int N >
+struct root_dims< dimensions<X...>, N >
+{
+    typedef dimensions< ( X / N )... > type;
+
+    enum { all_even_multiples = std::is_same< dimensions< ( X % N )... >, dimensions< ( X * 0 )... > >::value };
+};
+
+#endif // PHYS_UNITS_PACKED_DIMENSIONS
+
 /**
  * product type generator.
  */
 template< typename DX, typename DY, typename T >
 struct product
 {
-    enum
-    {
-        d1 = DX::dim1 + DY::dim1,
-        d2 = DX::dim2 + DY::dim2,
-        d3 = DX::dim3 + DY::dim3,
-        d4 = DX::dim4 + DY::dim4,
-        d5 = DX::dim5 + DY::dim5,
-        d6 = DX::dim6 + DY::dim6,
-        d7 = DX::dim7 + DY::dim7,
-    };
-
-    typedef Collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T > type;
+    typedef Collapse< ProductDims<DX, DY>, T > type;
 };
 
 template< typename DX, typename DY, typename X, typename Y>
-using Product = typename product<DX, DY, PromoteMul<X,Y>>::type;
+using Product = Collapse< ProductDims<DX, DY>, PromoteMul<X,Y> >;
 
 /**
  * quotient type generator.
@@ -159,22 +504,11 @@ using Product = typename product<DX, DY, PromoteMul<X,Y>>::type;
 template< typename DX, typename DY, typename T >
 struct quotient
 {
-    enum
-    {
-        d1 = DX::dim1 - DY::dim1,
-        d2 = DX::dim2 - DY::dim2,
-        d3 = DX::dim3 - DY::dim3,
-        d4 = DX::dim4 - DY::dim4,
-        d5 = DX::dim5 - DY::dim5,
-        d6 = DX::dim6 - DY::dim6,
-        d7 = DX::dim7 - DY::dim7,
-    };
-
-    typedef Collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T > type;
+    typedef Collapse< QuotientDims<DX, DY>, T > type;
 };
 
 template< typename DX, typename DY, typename X, typename Y>
-using Quotient = typename quotient<DX, DY, PromoteMul<X,Y>>::type;
+using Quotient = Collapse< QuotientDims<DX, DY>, PromoteMul<X,Y> >;
 
 /**
  * reciprocal type generator.
@@ -182,22 +516,11 @@ using Quotient = typename quotient<DX, DY, PromoteMul<X,Y>>::type;
 template< typename D, typename T >
 struct reciprocal
 {
-    enum
-    {
-        d1 = - D::dim1,
-        d2 = - D::dim2,
-        d3 = - D::dim3,
-        d4 = - D::dim4,
-        d5 = - D::dim5,
-        d6 = - D::dim6,
-        d7 = - D::dim7,
-    };
-
-    typedef Collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T > type;
+    typedef Collapse< typename reciprocal_dims<D>::type, T > type;
 };
 
 template< typename D, typename X, typename Y>
-using Reciprocal = typename reciprocal<D, PromoteMul<X,Y>>::type;
+using Reciprocal = Collapse< typename reciprocal_dims<D>::type, PromoteMul<Y,X> >;
 
 /**
  * power type generator.
@@ -205,22 +528,11 @@ using Reciprocal = typename reciprocal<D, PromoteMul<X,Y>>::type;
 template< typename D, int N, typename T >
 struct power
 {
-    enum
-    {
-        d1 = N * D::dim1,
-        d2 = N * D::dim2,
-        d3 = N * D::dim3,
-        d4 = N * D::dim4,
-        d5 = N * D::dim5,
-        d6 = N * D::dim6,
-        d7 = N * D::dim7,
-    };
-
-    typedef Collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T > type;
+    typedef Collapse< typename power_dims<D, N>::type, T > type;
 };
 
 template< typename D, int N, typename T >
-using Power = typename detail::power< D, N, T >::type;
+using Power = Collapse< typename power_dims<D, N>::type, T >;
 
 /**
  * root type generator.
@@ -228,42 +540,37 @@ using Power = typename detail::power< D, N, T >::type;
 template< typename D, int N, typename T >
 struct root
 {
-    enum
-    {
-        all_even_multiples =
-            D::dim1 % N == 0 &&
-            D::dim2 % N == 0 &&
-            D::dim3 % N == 0 &&
-            D::dim4 % N == 0 &&
-            D::dim5 % N == 0 &&
-            D::dim6 % N == 0 &&
-            D::dim7 % N == 0
-    };
-
-    enum
-    {
-        d1 = D::dim1 / N,
-        d2 = D::dim2 / N,
-        d3 = D::dim3 / N,
-        d4 = D::dim4 / N,
-        d5 = D::dim5 / N,
-        d6 = D::dim6 / N,
-        d7 = D::dim7 / N
-    };
+    enum { all_even_multiples = root_dims<D, N>::all_even_multiples };
 
-    typedef Collapse< dimensions< d1, d2, d3, d4, d5, d6, d7 >, T > type;
+    typedef Collapse< typename root_dims<D, N>::type, T > type;
 };
 
 template< typename D, int N, typename T >
-using Root = typename detail::root< D, N, T >::type;
+using Root = Collapse< typename root_dims<D, N>::type, T >;
 
 /**
- * tag to construct a quantity from a magnitude.
+ * result R with magnitude x; a plain number for a dimensionless result.
  */
-constexpr struct magnitude_tag_t{} magnitude_tag{};
+template< typename R >
+struct from_magnitude
+{
+    template< typename X >
+    static constexpr R make( X const x ) { return R( x ); }
+};
+
+#ifndef PHYS_UNITS_ERASED
+template< typename D, typename T >
+struct from_magnitude< quantity<D, T> >
+{
+    template< typename X >
+    static constexpr quantity<D, T> make( X const x ) { return quantity<D, T>( magnitude_tag, x ); }
+};
+#endif
 
 } // namespace detail
 
+#ifndef PHYS_UNITS_ERASED
+
 /**
  * \brief class "quantity" is the heart of the library. It associates
  * dimensions  with a single "Rep" data member and protects it from
@@ -279,21 +586,33 @@ public:
 
     typedef quantity<Dims, T> this_type;
 
-    constexpr quantity() : m_value{} { }
+    PHYS_UNITS_INLINE constexpr quantity() : m_value{} { }
+
+    /**
+     * uninitialized quantity; only assign to it or destroy it.
+     */
+#if defined( __GNUC__ )
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Weffc++"
+#endif
+    PHYS_UNITS_INLINE explicit quantity( no_init_t ) { }
+#if defined( __GNUC__ )
+# pragma GCC diagnostic pop
+#endif
 
     /**
      * public converting initializing constructor;
      * requires magnitude_tag to prevent constructing a quantity from a raw magnitude.
      */
     template <typename X>
-    constexpr explicit quantity( detail::magnitude_tag_t, X x )
+    PHYS_UNITS_INLINE constexpr explicit quantity( detail::magnitude_tag_t, X x )
     : m_value( x ) { }
 
     /**
      * converting copy-assignment constructor.
      */
     template <typename X >
-    constexpr quantity( quantity<Dims, X> const & x )
+    PHYS_UNITS_INLINE constexpr quantity( quantity<Dims, X> const & x )
     : m_value( x.magnitude() ) { }
 
 //    /**
@@ -313,7 +632,7 @@ public:
     /**
      * the quantity's magnitude.
      */
-    constexpr value_type magnitude() const { return m_value; }
+    PHYS_UNITS_INLINE constexpr value_type magnitude() const { return m_value; }
 
     /**
      * the quantity's dimensions.
@@ -326,14 +645,14 @@ public:
      * zero is really just defined for convenience, since
      * quantity< length_d >::zero == 0 * meter, etc.
      */
-    static constexpr quantity zero() { return quantity{ value_type( 0.0 ) }; }
+    static constexpr quantity zero() { return quantity{ value_type( 0 ) }; }
 //    static constexpr quantity zero = quantity{ value_type( 0.0 ) };
 
 private:
     /**
      * private initializing constructor.
      */
-    constexpr explicit quantity( value_type x ) : m_value{ x } { }
+    PHYS_UNITS_INLINE constexpr explicit quantity( value_type x ) : m_value{ x } { }
 
 private:
     value_type m_value;
@@ -343,152 +662,265 @@ private:
     static_assert( has_dimension, "quantity dimensions must not all be zero" );
 
 private:
-    // friends:
+    // friends, only those that may yield a plain number for a dimensionless
+    // result; the other operators use the public magnitude_tag constructor.
 
-    // arithmetic
+    template <typename DX, typename DY, typename X, typename Y>
+    friend constexpr detail::Product<DX, DY, X, Y>
+    operator*( quantity<DX, X> const & lhs, quantity< DY, Y > const & rhs );
 
-    template <typename D, typename X, typename Y>
-    friend constexpr quantity<D, X> &
-    operator+=( quantity<D, X> & x, quantity<D, Y> const & y );
+    template <typename D, typename X, typename Y, typename>
+    friend constexpr detail::Reciprocal<D, X, Y>
+    operator/( const X & x, quantity<D, Y> const & y );
 
-    template <typename D, typename X>
-    friend constexpr quantity<D, X>
-    operator+( quantity<D, X> const & x );
+    template <typename DX, typename DY, typename X, typename Y>
+    friend constexpr detail::Quotient<DX, DY, X, Y>
+    operator/( quantity<DX, X> const & x, quantity< DY, Y > const & y );
 
-    template< typename D, typename X, typename Y >
-    friend constexpr quantity <D, detail::PromoteAdd<X,Y>>
-    operator+( quantity<D, X> const & x, quantity<D, Y> const & y );
+    template <int N, typename D, typename X>
+    friend constexpr detail::Power<D, N, X>
+    nth_power( quantity<D, X> const & x );
 
-    template <typename D, typename X, typename Y>
-    friend constexpr quantity<D, X> &
-    operator-=( quantity<D, X> & x, quantity<D, Y> const & y );
+    template <int N, typename D, typename X>
+    friend detail::Root<D, N, X>
+    nth_root( quantity<D, X> const & x );
 
     template <typename D, typename X>
-    friend constexpr quantity<D, X>
-    operator-( quantity<D, X> const & x );
+    friend detail::Root< D, 2, X >
+    sqrt( quantity<D, X> const & x );
+};
 
-    template< typename D, typename X, typename Y >
-    friend constexpr quantity <D, detail::PromoteAdd<X,Y>>
-    operator-( quantity<D, X> const & x, quantity<D, Y> const & y );
+#endif // PHYS_UNITS_ERASED
 
-    template< typename D, typename X, typename Y>
-    friend constexpr quantity<D, X> &
-    operator*=( quantity<D, X> & x, const Y & y );
+/// namespace detail.
 
-    template <typename D, typename X, typename Y>
-    friend constexpr quantity<D, detail::PromoteMul<X,Y>>
-    operator*( quantity<D, X> const & x, const Y & y );
+namespace detail {
 
-    template <typename D, typename X, typename Y>
-    friend constexpr quantity< D, detail::PromoteMul<X,Y> >
-    operator*( const X & x, quantity<D, Y> const & y );
+/**
+ * layout contract: a quantity is represented exactly like its magnitude,
+ * so that a buffer of T can be viewed as a buffer of quantity<D, T>
+ * and vice versa without copying (see quantity_span in quantity_array.hpp).
+ */
+template< typename D, typename T >
+struct has_magnitude_layout : std::integral_constant< bool,
+    std::is_standard_layout< quantity<D, T> >::value &&
+    std::is_trivially_copyable< quantity<D, T> >::value &&
+    sizeof ( quantity<D, T> ) == sizeof ( T ) &&
+    alignof( quantity<D, T> ) == alignof( T ) > { };
 
-    template <typename DX, typename DY, typename X, typename Y>
-    friend constexpr detail::Product<DX, DY, X, Y>
-    operator*( quantity<DX, X> const & lhs, quantity< DY, Y > const & rhs );
+/**
+ * integral power by repeated squaring, exact for integral types.
+ */
+template< typename X >
+constexpr X integral_power( X const x, unsigned const n )
+{
+    return n == 0 ? X( 1 ) : ( n % 2 ? x : X( 1 ) ) * integral_power( x * x, n / 2 );
+}
 
-    template< typename D, typename X, typename Y>
-    friend constexpr quantity<D, X> &
-    operator/=( quantity<D, X> & x, const Y & y );
+/**
+ * N-th power by repeated squaring, unrolled at compile time into
+ * a chain of about 2 log2(N) multiplications.
+ */
+template< unsigned N, unsigned Odd = N % 2 >
+struct unrolled_power
+{
+    template< typename X >
+    static constexpr X apply( X const x ) { return unrolled_power<N / 2>::apply( x * x ); }
+};
 
-    template <typename D, typename X, typename Y>
-    friend constexpr quantity<D, detail::PromoteMul<X,Y>>
-    operator/( quantity<D, X> const & x, const Y & y );
+template< unsigned N >
+struct unrolled_power< N, 1 >
+{
+    template< typename X >
+    static constexpr X apply( X const x ) { return x * unrolled_power<N / 2>::apply( x * x ); }
+};
 
-    template <typename D, typename X, typename Y>
-    friend constexpr detail::Reciprocal<D, X, Y>
-    operator/( const X & x, quantity<D, Y> const & y );
+template<>
+struct unrolled_power< 1, 1 >
+{
+    template< typename X >
+    static constexpr X apply( X const x ) { return x; }
+};
 
-    template <typename DX, typename DY, typename X, typename Y>
-    friend constexpr detail::Quotient<DX, DY, X, Y>
-    operator/( quantity<DX, X> const & x, quantity< DY, Y > const & y );
+template<>
+struct unrolled_power< 0, 0 >
+{
+    template< typename X >
+    static constexpr X apply( X const ) { return X( 1 ); }
+};
+
+/**
+ * N-th power of a magnitude, including negative N; a multiplication chain
+ * for every number type, exact for integral types.
+ */
+template< int N, typename X >
+struct magnitude_power
+{
+    static constexpr X apply( X const x )
+    {
+        return N < 0 ? X( 1 ) / unrolled_power< unsigned( N < 0 ? -N : N ) >::apply( x )
+                     : unrolled_power< unsigned( N < 0 ? -N : N ) >::apply( x );
+    }
+};
 
-    // absolute value.
+/**
+ * N-th root of a magnitude: std::sqrt() for N = 2, std::cbrt() for N = 3,
+ * repeated square roots for other even N, std::pow() otherwise; the
+ * functions of user-defined number types are found via ADL.
+ * Integral roots are rounded to the nearest integer; exact for perfect powers.
+ */
+enum { root_reciprocal, root_identity, root_sqrt, root_cbrt, root_even, root_pow, root_integral };
 
-    template <typename D, typename X>
-    friend constexpr quantity<D,X>
-    abs( quantity<D,X> const & x );
+template< int N, typename X >
+struct root_kind : std::integral_constant< int,
+    std::is_integral<X>::value ? root_integral :
+    N < 0  ? root_reciprocal : N == 1 ? root_identity : N == 2 ? root_sqrt :
+    N == 3 ? root_cbrt : N % 2 == 0 ? root_even : root_pow > { };
 
-    // powers and roots
+template< int N, typename X, int = root_kind<N, X>::value >
+struct magnitude_root
+{
+    static X apply( X const x ) { using std::pow; return pow( x, X( 1.0 ) / N ); }
+};
 
-    template <int N, typename D, typename X>
-    friend detail::Power<D, N, X>
-    nth_power( quantity<D, X> const & x );
+template< int N, typename X >
+struct magnitude_root< N, X, root_reciprocal >
+{
+    static X apply( X const x ) { return X( 1 ) / magnitude_root< -N, X >::apply( x ); }
+};
 
-    template <typename D, typename X>
-    friend constexpr detail::Power<D, 2, X>
-    square( quantity<D, X> const & x );
+template< int N, typename X >
+struct magnitude_root< N, X, root_identity >
+{
+    static X apply( X const x ) { return x; }
+};
 
-    template <typename D, typename X>
-    friend constexpr detail::Power<D, 3, X>
-    cube( quantity<D, X> const & x );
+template< int N, typename X >
+struct magnitude_root< N, X, root_sqrt >
+{
+    static X apply( X const x ) { using std::sqrt; return sqrt( x ); }
+};
 
-    template <int N, typename D, typename X>
-    friend detail::Root<D, N, X>
-    nth_root( quantity<D, X> const & x );
+template< int N, typename X >
+struct magnitude_root< N, X, root_cbrt >
+{
+    static X apply( X const x ) { using std::cbrt; return refine( cbrt( x ), x, std::is_floating_point<X>() ); }
 
-    template <typename D, typename X>
-    friend detail::Root< D, 2, X >
-    sqrt( quantity<D, X> const & x );
+    // one Newton step, as std::cbrt() may be off by an ulp for perfect cubes:
 
-    // comparison
+    static X refine( X const y, X const x, std::true_type )
+    {
+        return std::isnormal( y ) ? y - ( y * y * y - x ) / ( 3 * y * y ) : y;
+    }
 
-    template <typename D, typename X, typename Y>
-    friend constexpr bool operator==( quantity<D, X> const & x, quantity<D, Y> const & y );
+    static X refine( X const y, X const, std::false_type ) { return y; }
+};
 
-    template <typename D, typename X, typename Y>
-    friend constexpr bool operator!=( quantity<D, X> const & x, quantity<D, Y> const & y );
+template< int N, typename X >
+struct magnitude_root< N, X, root_even >
+{
+    static X apply( X const x ) { using std::sqrt; return magnitude_root< N / 2, X >::apply( sqrt( x ) ); }
+};
 
-    template <typename D, typename X, typename Y>
-    friend constexpr bool operator<( quantity<D, X> const & x, quantity<D, Y> const & y );
+template< int N, typename X >
+struct magnitude_root< N, X, root_integral >
+{
+    static X apply( X const x ) { return X( std::llround( magnitude_root< N, double >::apply( double( x ) ) ) ); }
+};
 
-    template <typename D, typename X, typename Y>
-    friend constexpr bool operator<=( quantity<D, X> const & x, quantity<D, Y> const & y );
+} // namespace detail
 
-    template <typename D, typename X, typename Y>
-    friend constexpr bool operator>( quantity<D, X> const & x, quantity<D, Y> const & y );
+#ifdef PHYS_UNITS_ERASED
 
-    template <typename D, typename X, typename Y>
-    friend constexpr bool operator>=( quantity<D, X> const & x, quantity<D, Y> const & y );
-};
+/*
+ * With dimensions erased, quantity<D, T> is T: the operators are those of
+ * the magnitude type and these functions stand in for those of quantity.
+ */
+
+/// absolute value.
 
-// Give names to the seven fundamental dimensions of physical reality.
+template <typename X>
+PHYS_UNITS_INLINE constexpr detail::EnableIfNumber<X, X> abs( X const x )
+{
+   return x < X( 0 ) ? -x : x;
+}
 
-typedef dimensions< 1, 0, 0, 0, 0, 0, 0 > length_d;
-typedef dimensions< 0, 1, 0, 0, 0, 0, 0 > mass_d;
-typedef dimensions< 0, 0, 1, 0, 0, 0, 0 > time_interval_d;
-typedef dimensions< 0, 0, 0, 1, 0, 0, 0 > electric_current_d;
-typedef dimensions< 0, 0, 0, 0, 1, 0, 0 > thermodynamic_temperature_d;
-typedef dimensions< 0, 0, 0, 0, 0, 1, 0 > amount_of_substance_d;
-typedef dimensions< 0, 0, 0, 0, 0, 0, 1 > luminous_intensity_d;
+/// N-th power.
+
+template <int N, typename X>
+PHYS_UNITS_INLINE constexpr detail::EnableIfNumber<X, X> nth_power( X const x )
+{
+   return detail::magnitude_power<N, X>::apply( x );
+}
+
+/// square.
+
+template <typename X>
+PHYS_UNITS_INLINE constexpr detail::EnableIfNumber<X, X> square( X const x )
+{
+   return x * x;
+}
+
+/// cube.
+
+template <typename X>
+PHYS_UNITS_INLINE constexpr detail::EnableIfNumber<X, X> cube( X const x )
+{
+   return x * x * x;
+}
+
+/// n-th root.
+
+template <int N, typename X>
+PHYS_UNITS_INLINE detail::EnableIfNumber<X, X> nth_root( X const x )
+{
+   return detail::magnitude_root<N, X>::apply( x );
+}
+
+/// square root.
+
+template <typename X>
+PHYS_UNITS_INLINE detail::EnableIfNumber<X, X> sqrt( X const x )
+{
+   return detail::magnitude_root<2, X>::apply( x );
+}
+
+/// quantity's magnitude.
+
+template <typename X>
+PHYS_UNITS_INLINE constexpr detail::EnableIfNumber<X, X> magnitude( X const x ) { return x; }
+
+#else // PHYS_UNITS_ERASED
 
 // Addition operators
 
 /// quan += quan
 
 template <typename D, typename X, typename Y>
-constexpr quantity<D, X> &
+PHYS_UNITS_INLINE quantity<D, X> &
 operator+=( quantity<D, X> & x, quantity<D, Y> const & y )
 {
-    return x.m_value += y.m_value, x;
+    return x = quantity<D, X>( detail::magnitude_tag, x.magnitude() + detail::PromoteAdd<X,Y>( y.magnitude() ) );
 }
 
 /// + quan
 
 template <typename D, typename X>
-constexpr quantity<D, X>
+PHYS_UNITS_INLINE constexpr quantity<D, X>
 operator+( quantity<D, X> const & x )
 {
-   return quantity<D, X >( +x.m_value );
+   return quantity<D, X >( detail::magnitude_tag, +x.magnitude() );
 }
 
 /// quan + quan
 
 template< typename D, typename X, typename Y >
-constexpr quantity <D, detail::PromoteAdd<X,Y>>
+PHYS_UNITS_INLINE constexpr quantity <D, detail::PromoteAdd<X,Y>>
 operator+( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return quantity<D, detail::PromoteAdd<X,Y>>( x.m_value + y.m_value );
+   typedef detail::PromoteAdd<X,Y> R;
+
+   return quantity<D, R>( detail::magnitude_tag, R( x.magnitude() ) + R( y.magnitude() ) );
 }
 
 // Subtraction operators
@@ -496,112 +928,128 @@ operator+( quantity<D, X> const & x, quantity<D, Y> const & y )
 /// quan -= quan
 
 template <typename D, typename X, typename Y>
-constexpr quantity<D, X> &
+PHYS_UNITS_INLINE quantity<D, X> &
 operator-=( quantity<D, X> & x, quantity<D, Y> const & y )
 {
-    return x.m_value -= y.m_value, x;
+    return x = quantity<D, X>( detail::magnitude_tag, x.magnitude() - detail::PromoteAdd<X,Y>( y.magnitude() ) );
 }
 
 /// - quan
 
 template <typename D, typename X>
-constexpr quantity<D, X>
+PHYS_UNITS_INLINE constexpr quantity<D, X>
 operator-( quantity<D, X> const & x )
 {
-   return quantity<D, X >( -x.m_value );
+   return quantity<D, X >( detail::magnitude_tag, -x.magnitude() );
 }
 
 /// quan - quan
 
 template< typename D, typename X, typename Y >
-constexpr quantity <D, detail::PromoteAdd<X,Y>>
+PHYS_UNITS_INLINE constexpr quantity <D, detail::PromoteAdd<X,Y>>
 operator-( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return quantity<D, detail::PromoteAdd<X,Y>>( x.m_value - y.m_value );
+   typedef detail::PromoteAdd<X,Y> R;
+
+   return quantity<D, R>( detail::magnitude_tag, R( x.magnitude() ) - R( y.magnitude() ) );
 }
 
 // Multiplication operators
 
 /// quan *= num
 
-template< typename D, typename X, typename Y>
-constexpr quantity<D, X> &
+template< typename D, typename X, typename Y, typename = detail::EnableIfScalar<Y>>
+PHYS_UNITS_INLINE quantity<D, X> &
 operator*=( quantity<D, X> & x, const Y & y )
 {
-   return x.m_value *= y, x;
+    return x = quantity<D, X>( detail::magnitude_tag, x.magnitude() * detail::PromoteMul<X,Y>( y ) );
 }
 
 /// quan * num
 
-template <typename D, typename X, typename Y>
-constexpr quantity<D, detail::PromoteMul<X,Y>>
+template <typename D, typename X, typename Y, typename = detail::EnableIfScalar<Y>>
+PHYS_UNITS_INLINE constexpr quantity<D, detail::PromoteMul<X,Y>>
 operator*( quantity<D, X> const & x, const Y & y )
 {
-   return quantity<D, detail::PromoteMul<X,Y>>( x.m_value * y );
+   typedef detail::PromoteMul<X,Y> R;
+
+   return quantity<D, R>( detail::magnitude_tag, R( x.magnitude() ) * R( y ) );
 }
 
 /// num * quan
 
-template <typename D, typename X, typename Y>
-constexpr quantity< D, detail::PromoteMul<X,Y> >
+template <typename D, typename X, typename Y, typename = detail::EnableIfScalar<X>>
+PHYS_UNITS_INLINE constexpr quantity< D, detail::PromoteMul<Y,X> >
 operator*( const X & x, quantity<D, Y> const & y )
 {
-   return quantity<D, detail::PromoteMul<X,Y>>( x * y.m_value );
+   typedef detail::PromoteMul<Y,X> R;
+
+   return quantity<D, R>( detail::magnitude_tag, R( x ) * R( y.magnitude() ) );
 }
 
 /// quan * quan:
 
 template <typename DX, typename DY, typename X, typename Y>
-constexpr detail::Product<DX, DY, X, Y>
+PHYS_UNITS_INLINE constexpr detail::Product<DX, DY, X, Y>
 operator*( quantity<DX, X> const & lhs, quantity< DY, Y > const & rhs )
 {
-    return detail::Product<DX, DY, X, Y>( lhs.m_value * rhs.m_value );
+    typedef detail::PromoteMul<X,Y> R;
+
+    return detail::Product<DX, DY, X, Y>( R( lhs.m_value ) * R( rhs.m_value ) );
 }
 
 // Division operators
 
 /// quan /= num
 
-template< typename D, typename X, typename Y>
-constexpr quantity<D, X> &
+template< typename D, typename X, typename Y, typename = detail::EnableIfScalar<Y>>
+PHYS_UNITS_INLINE quantity<D, X> &
 operator/=( quantity<D, X> & x, const Y & y )
 {
-   return x.m_value /= y, x;
+    return x = quantity<D, X>( detail::magnitude_tag, x.magnitude() / detail::PromoteMul<X,Y>( y ) );
 }
 
 /// quan / num
 
-template <typename D, typename X, typename Y>
-constexpr quantity<D, detail::PromoteMul<X,Y>>
+template <typename D, typename X, typename Y, typename = detail::EnableIfScalar<Y>>
+PHYS_UNITS_INLINE constexpr quantity<D, detail::PromoteMul<X,Y>>
 operator/( quantity<D, X> const & x, const Y & y )
 {
-   return quantity<D, detail::PromoteMul<X,Y>>( x.m_value / y );
+   typedef detail::PromoteMul<X,Y> R;
+
+   return quantity<D, R>( detail::magnitude_tag, R( x.magnitude() ) / R( y ) );
 }
 
 /// num / quan
 
-template <typename D, typename X, typename Y>
-constexpr detail::Reciprocal<D, X, Y>
+template <typename D, typename X, typename Y, typename = detail::EnableIfScalar<X>>
+PHYS_UNITS_INLINE constexpr detail::Reciprocal<D, X, Y>
 operator/( const X & x, quantity<D, Y> const & y )
 {
-   return detail::Reciprocal<D, X, Y>( x / y.m_value );
+   typedef detail::PromoteMul<Y,X> R;
+
+   return detail::Reciprocal<D, X, Y>( R( x ) / R( y.m_value ) );
 }
 
 /// quan / quan:
 
 template <typename DX, typename DY, typename X, typename Y>
-constexpr detail::Quotient<DX, DY, X, Y>
+PHYS_UNITS_INLINE constexpr detail::Quotient<DX, DY, X, Y>
 operator/( quantity<DX, X> const & x, quantity< DY, Y > const & y )
 {
-    return detail::Quotient<DX, DY, X, Y>( x.m_value / y.m_value );
+    typedef detail::PromoteMul<X,Y> R;
+
+    return detail::Quotient<DX, DY, X, Y>( R( x.m_value ) / R( y.m_value ) );
 }
 
 /// absolute value.
 
 template <typename D, typename X>
-constexpr quantity<D,X> abs( quantity<D,X> const & x )
+PHYS_UNITS_INLINE constexpr quantity<D,X> abs( quantity<D,X> const & x )
 {
-   return quantity<D,X>( std::abs( x.m_value ) );
+   using std::abs;
+
+   return quantity<D,X>( detail::magnitude_tag, abs( x.magnitude() ) );
 }
 
 // General powers
@@ -609,10 +1057,10 @@ constexpr quantity<D,X> abs( quantity<D,X> const & x )
 /// N-th power.
 
 template <int N, typename D, typename X>
-detail::Power<D, N, X>
+PHYS_UNITS_INLINE constexpr detail::Power<D, N, X>
 nth_power( quantity<D, X> const & x )
 {
-   return detail::Power<D, N, X>( std::pow( x.m_value, X( N ) ) );
+   return detail::Power<D, N, X>( detail::magnitude_power<N, X>::apply( x.m_value ) );
 }
 
 // Low powers defined separately for efficiency.
@@ -620,7 +1068,7 @@ nth_power( quantity<D, X> const & x )
 /// square.
 
 template <typename D, typename X>
-constexpr detail::Power<D, 2, X>
+PHYS_UNITS_INLINE constexpr detail::Power<D, 2, X>
 square( quantity<D, X> const & x )
 {
    return x * x;
@@ -629,7 +1077,7 @@ square( quantity<D, X> const & x )
 /// cube.
 
 template <typename D, typename X>
-constexpr detail::Power<D, 3, X>
+PHYS_UNITS_INLINE constexpr detail::Power<D, 3, X>
 cube( quantity<D, X> const & x )
 {
    return x * x * x;
@@ -640,12 +1088,12 @@ cube( quantity<D, X> const & x )
 /// n-th root.
 
 template <int N, typename D, typename X>
-detail::Root<D, N, X>
+PHYS_UNITS_INLINE detail::Root<D, N, X>
 nth_root( quantity<D, X> const & x )
 {
-   static_assert( detail::root<D, N, X>::all_even_multiples, "root result dimensions must be integral" );
+   static_assert( detail::root_dims<D, N>::all_even_multiples, "root result dimensions must be integral" );
 
-   return detail::Root<D, N, X>( std::pow( x.m_value, X( 1.0 ) / N ) );
+   return detail::Root<D, N, X>( detail::magnitude_root<N, X>::apply( x.m_value ) );
 }
 
 // Low roots defined separately for convenience.
@@ -653,13 +1101,13 @@ nth_root( quantity<D, X> const & x )
 /// square root.
 
 template <typename D, typename X>
-detail::Root< D, 2, X >
+PHYS_UNITS_INLINE detail::Root< D, 2, X >
 sqrt( quantity<D, X> const & x )
 {
    static_assert(
-      detail::root<D, 2, X >::all_even_multiples, "root result dimensions must be integral" );
+      detail::root_dims<D, 2>::all_even_multiples, "root result dimensions must be integral" );
 
-   return detail::Root<D, 2, X>( std::pow( x.m_value, X( 1.0 ) / 2 ) );
+   return detail::Root<D, 2, X>( detail::magnitude_root<2, X>::apply( x.m_value ) );
 }
 
 // Comparison operators
@@ -667,55 +1115,55 @@ sqrt( quantity<D, X> const & x )
 /// equality.
 
 template <typename D, typename X, typename Y>
-constexpr bool
+PHYS_UNITS_INLINE constexpr bool
 operator==( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return x.m_value == y.m_value;
+   return x.magnitude() == y.magnitude();
 }
 
 /// inequality.
 
 template <typename D, typename X, typename Y>
-constexpr bool
+PHYS_UNITS_INLINE constexpr bool
 operator!=( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return x.m_value != y.m_value;
+   return x.magnitude() != y.magnitude();
 }
 
 /// less-than.
 
 template <typename D, typename X, typename Y>
-constexpr bool
+PHYS_UNITS_INLINE constexpr bool
 operator<( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return x.m_value < y.m_value;
+   return x.magnitude() < y.magnitude();
 }
 
 /// less-equal.
 
 template <typename D, typename X, typename Y>
-constexpr bool
+PHYS_UNITS_INLINE constexpr bool
 operator<=( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return x.m_value <= y.m_value;
+   return x.magnitude() <= y.magnitude();
 }
 
 /// greater-than.
 
 template <typename D, typename X, typename Y>
-constexpr bool
+PHYS_UNITS_INLINE constexpr bool
 operator>( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return x.m_value > y.m_value;
+   return x.magnitude() > y.magnitude();
 }
 
 /// greater-equal.
 
 template <typename D, typename X, typename Y>
-constexpr bool
+PHYS_UNITS_INLINE constexpr bool
 operator>=( quantity<D, X> const & x, quantity<D, Y> const & y )
 {
-   return x.m_value >= y.m_value;
+   return x.magnitude() >= y.magnitude();
 }
 
 /// quantity's dimension.
@@ -726,222 +1174,133 @@ inline constexpr DX dimension( quantity<DX,X> const & q ) { return q.dimension()
 /// quantity's magnitude.
 
 template <typename DX, typename X>
-inline constexpr X magnitude( quantity<DX,X> const & q ) { return q.magnitude(); }
+PHYS_UNITS_INLINE constexpr X magnitude( quantity<DX,X> const & q ) { return q.magnitude(); }
+
+#endif // PHYS_UNITS_ERASED
+
+static_assert( detail::has_magnitude_layout< length_d, Rep         >::value, "quantity must have the layout of its magnitude" );
+static_assert( detail::has_magnitude_layout< length_d, float       >::value, "quantity must have the layout of its magnitude" );
+static_assert( detail::has_magnitude_layout< length_d, double      >::value, "quantity must have the layout of its magnitude" );
+static_assert( detail::has_magnitude_layout< length_d, long double >::value, "quantity must have the layout of its magnitude" );
 
 // The seven SI base units.  These tie our numbers to the real world.
 
-constexpr quantity<length_d                   > meter   { detail::magnitude_tag, 1.0 };
-constexpr quantity<mass_d                     > kilogram{ detail::magnitude_tag, 1.0 };
-constexpr quantity<time_interval_d            > second  { detail::magnitude_tag, 1.0 };
-constexpr quantity<electric_current_d         > ampere  { detail::magnitude_tag, 1.0 };
-constexpr quantity<thermodynamic_temperature_d> kelvin  { detail::magnitude_tag, 1.0 };
-constexpr quantity<amount_of_substance_d      > mole    { detail::magnitude_tag, 1.0 };
-constexpr quantity<luminous_intensity_d       > candela { detail::magnitude_tag, 1.0 };
+PHYS_UNITS_CONSTANT quantity<length_d                   > meter   { detail::from_magnitude< quantity<length_d                   > >::make( 1.0 ) };
+PHYS_UNITS_CONSTANT quantity<mass_d                     > kilogram{ detail::from_magnitude< quantity<mass_d                     > >::make( 1.0 ) };
+PHYS_UNITS_CONSTANT quantity<time_interval_d            > second  { detail::from_magnitude< quantity<time_interval_d            > >::make( 1.0 ) };
+PHYS_UNITS_CONSTANT quantity<electric_current_d         > ampere  { detail::from_magnitude< quantity<electric_current_d         > >::make( 1.0 ) };
+PHYS_UNITS_CONSTANT quantity<thermodynamic_temperature_d> kelvin  { detail::from_magnitude< quantity<thermodynamic_temperature_d> >::make( 1.0 ) };
+PHYS_UNITS_CONSTANT quantity<amount_of_substance_d      > mole    { detail::from_magnitude< quantity<amount_of_substance_d      > >::make( 1.0 ) };
+PHYS_UNITS_CONSTANT quantity<luminous_intensity_d       > candela { detail::from_magnitude< quantity<luminous_intensity_d       > >::make( 1.0 ) };
 
 // The standard SI prefixes.
 
-constexpr long double yotta = 1e+24L;
-constexpr long double zetta = 1e+21L;
-constexpr long double   exa = 1e+18L;
-constexpr long double  peta = 1e+15L;
-constexpr long double  tera = 1e+12L;
-constexpr long double  giga = 1e+9L;
-constexpr long double  mega = 1e+6L;
-constexpr long double  kilo = 1e+3L;
-constexpr long double hecto = 1e+2L;
-constexpr long double  deka = 1e+1L;
-constexpr long double  deci = 1e-1L;
-constexpr long double centi = 1e-2L;
-constexpr long double milli = 1e-3L;
-constexpr long double micro = 1e-6L;
-constexpr long double  nano = 1e-9L;
-constexpr long double  pico = 1e-12L;
-constexpr long double femto = 1e-15L;
-constexpr long double  atto = 1e-18L;
-constexpr long double zepto = 1e-21L;
-constexpr long double yocto = 1e-24L;
+PHYS_UNITS_CONSTANT long double yotta = 1e+24L;
+PHYS_UNITS_CONSTANT long double zetta = 1e+21L;
+PHYS_UNITS_CONSTANT long double   exa = 1e+18L;
+PHYS_UNITS_CONSTANT long double  peta = 1e+15L;
+PHYS_UNITS_CONSTANT long double  tera = 1e+12L;
+PHYS_UNITS_CONSTANT long double  giga = 1e+9L;
+PHYS_UNITS_CONSTANT long double  mega = 1e+6L;
+PHYS_UNITS_CONSTANT long double  kilo = 1e+3L;
+PHYS_UNITS_CONSTANT long double hecto = 1e+2L;
+PHYS_UNITS_CONSTANT long double  deka = 1e+1L;
+PHYS_UNITS_CONSTANT long double  deci = 1e-1L;
+PHYS_UNITS_CONSTANT long double centi = 1e-2L;
+PHYS_UNITS_CONSTANT long double milli = 1e-3L;
+PHYS_UNITS_CONSTANT long double micro = 1e-6L;
+PHYS_UNITS_CONSTANT long double  nano = 1e-9L;
+PHYS_UNITS_CONSTANT long double  pico = 1e-12L;
+PHYS_UNITS_CONSTANT long double femto = 1e-15L;
+PHYS_UNITS_CONSTANT long double  atto = 1e-18L;
+PHYS_UNITS_CONSTANT long double zepto = 1e-21L;
+PHYS_UNITS_CONSTANT long double yocto = 1e-24L;
 
 // Binary prefixes, pending adoption.
 
-constexpr long double kibi = 1024;
-constexpr long double mebi = 1024 * kibi;
-constexpr long double gibi = 1024 * mebi;
-constexpr long double tebi = 1024 * gibi;
-constexpr long double pebi = 1024 * tebi;
-constexpr long double exbi = 1024 * pebi;
-constexpr long double zebi = 1024 * exbi;
-constexpr long double yobi = 1024 * zebi;
-
-// The rest of the standard dimensional types, as specified in SP811.
-
-using absorbed_dose_d             = dimensions< 2, 0, -2 >;
-using absorbed_dose_rate_d        = dimensions< 2, 0, -3 >;
-using acceleration_d              = dimensions< 1, 0, -2 >;
-using activity_of_a_nuclide_d     = dimensions< 0, 0, -1 >;
-using angular_velocity_d          = dimensions< 0, 0, -1 >;
-using angular_acceleration_d      = dimensions< 0, 0, -2 >;
-using area_d                      = dimensions< 2, 0, 0 >;
-using capacitance_d               = dimensions< -2, -1, 4, 2 >;
-using concentration_d             = dimensions< -3, 0, 0, 0, 0, 1 >;
-using current_density_d           = dimensions< -2, 0, 0, 1 >;
-using dose_equivalent_d           = dimensions< 2, 0, -2 >;
-using dynamic_viscosity_d         = dimensions< -1, 1, -1 >;
-using electric_charge_d           = dimensions< 0, 0, 1, 1 >;
-using electric_charge_density_d   = dimensions< -3, 0, 1, 1 >;
-using electric_conductance_d      = dimensions< -2, -1, 3, 2 >;
-using electric_field_strenth_d    = dimensions< 1, 1, -3, -1 >;
-using electric_flux_density_d     = dimensions< -2, 0, 1, 1 >;
-using electric_potential_d        = dimensions< 2, 1, -3, -1 >;
-using electric_resistance_d       = dimensions< 2, 1, -3, -2 >;
-using energy_d                    = dimensions< 2, 1, -2 >;
-using energy_density_d            = dimensions< -1, 1, -2 >;
-using exposure_d                  = dimensions< 0, -1, 1, 1 >;
-using force_d                     = dimensions< 1, 1, -2 >;
-using frequency_d                 = dimensions< 0, 0, -1 >;
-using heat_capacity_d             = dimensions< 2, 1, -2, 0, -1 >;
-using heat_density_d              = dimensions< 0, 1, -2 >;
-using heat_density_flow_rate_d    = dimensions< 0, 1, -3 >;
-using heat_flow_rate_d            = dimensions< 2, 1, -3 >;
-using heat_flux_density_d         = dimensions< 0, 1, -3 >;
-using heat_transfer_coefficient_d = dimensions< 0, 1, -3, 0, -1 >;
-using illuminance_d               = dimensions< -2, 0, 0, 0, 0, 0, 1 >;
-using inductance_d                = dimensions< 2, 1, -2, -2 >;
-using irradiance_d                = dimensions< 0, 1, -3 >;
-using kinematic_viscosity_d       = dimensions< 2, 0, -1 >;
-using luminance_d                 = dimensions< -2, 0, 0, 0, 0, 0, 1 >;
-using luminous_flux_d             = dimensions< 0, 0, 0, 0, 0, 0, 1 >;
-using magnetic_field_strength_d   = dimensions< -1, 0, 0, 1 >;
-using magnetic_flux_d             = dimensions< 2, 1, -2, -1 >;
-using magnetic_flux_density_d     = dimensions< 0, 1, -2, -1 >;
-using magnetic_permeability_d     = dimensions< 1, 1, -2, -2 >;
-using mass_density_d              = dimensions< -3, 1, 0 >;
-using mass_flow_rate_d            = dimensions< 0, 1, -1 >;
-using molar_energy_d              = dimensions< 2, 1, -2, 0, 0, -1 >;
-using molar_entropy_d             = dimensions< 2, 1, -2, -1, 0, -1 >;
-using moment_of_force_d           = dimensions< 2, 1, -2 >;
-using permittivity_d              = dimensions< -3, -1, 4, 2 >;
-using power_d                     = dimensions< 2, 1, -3 >;
-using pressure_d                  = dimensions< -1, 1, -2 >;
-using radiance_d                  = dimensions< 0, 1, -3 >;
-using radiant_intensity_d         = dimensions< 2, 1, -3 >;
-using speed_d                     = dimensions< 1, 0, -1 >;
-using specific_energy_d           = dimensions< 2, 0, -2 >;
-using specific_heat_capacity_d    = dimensions< 2, 0, -2, 0, -1 >;
-using specific_volume_d           = dimensions< 3, -1, 0 >;
-using substance_permeability_d    = dimensions< -1, 0, 1 >;
-using surface_tension_d           = dimensions< 0, 1, -2 >;
-using thermal_conductivity_d      = dimensions< 1, 1, -3, 0, -1 >;
-using thermal_diffusivity_d       = dimensions< 2, 0, -1 >;
-using thermal_insulance_d         = dimensions< 0, -1, 3, 0, 1 >;
-using thermal_resistance_d        = dimensions< -2, -1, 3, 0, 1 >;
-using thermal_resistivity_d       = dimensions< -1, -1, 3, 0, 1 >;
-using torque_d                    = dimensions< 2, 1, -2 >;
-using volume_d                    = dimensions< 3, 0, 0 >;
-using volume_flow_rate_d          = dimensions< 3, 0, -1 >;
-using wave_number_d               = dimensions< -1, 0, 0 >;
+PHYS_UNITS_CONSTANT long double kibi = 1024;
+PHYS_UNITS_CONSTANT long double mebi = 1024 * kibi;
+PHYS_UNITS_CONSTANT long double gibi = 1024 * mebi;
+PHYS_UNITS_CONSTANT long double tebi = 1024 * gibi;
+PHYS_UNITS_CONSTANT long double pebi = 1024 * tebi;
+PHYS_UNITS_CONSTANT long double exbi = 1024 * pebi;
+PHYS_UNITS_CONSTANT long double zebi = 1024 * exbi;
+PHYS_UNITS_CONSTANT long double yobi = 1024 * zebi;
+
+// The named dimensional types, such as energy_d, are in quantity_fwd.hpp.
 
 // Handy values.
 
-constexpr Rep pi      { Rep( 3.141592653589793238462L ) };
-constexpr Rep percent { Rep( 1 ) / 100 };
+PHYS_UNITS_CONSTANT Rep pi      { Rep( 3.141592653589793238462L ) };
+PHYS_UNITS_CONSTANT Rep percent { Rep( 1 ) / 100 };
 
 //// Not approved for use alone, but needed for use with prefixes.
-constexpr quantity< mass_d                  > gram         { kilogram / 1000 };
+PHYS_UNITS_CONSTANT quantity< mass_d                  > gram         { kilogram / 1000 };
 
 // The derived SI units, as specified in SP811.
 
-constexpr Rep                                 radian       { Rep( 1 ) };
-constexpr Rep                                 steradian    { Rep( 1 ) };
-constexpr quantity< force_d                 > newton       { meter * kilogram / square( second ) };
-constexpr quantity< pressure_d              > pascal       { newton / square( meter ) };
-constexpr quantity< energy_d                > joule        { newton * meter };
-constexpr quantity< power_d                 > watt         { joule / second };
-constexpr quantity< electric_charge_d       > coulomb      { second * ampere };
-constexpr quantity< electric_potential_d    > volt         { watt / ampere };
-constexpr quantity< capacitance_d           > farad        { coulomb / volt };
-constexpr quantity< electric_resistance_d   > ohm          { volt / ampere };
-constexpr quantity< electric_conductance_d  > siemens      { ampere / volt };
-constexpr quantity< magnetic_flux_d         > weber        { volt * second };
-constexpr quantity< magnetic_flux_density_d > tesla        { weber / square( meter ) };
-constexpr quantity< inductance_d            > henry        { weber / ampere };
-constexpr quantity< thermodynamic_temperature_d > degree_celsius   { kelvin };
-constexpr quantity< luminous_flux_d         > lumen        { candela * steradian };
-constexpr quantity< illuminance_d           > lux          { lumen / meter / meter };
-constexpr quantity< activity_of_a_nuclide_d > becquerel    { 1 / second };
-constexpr quantity< absorbed_dose_d         > gray         { joule / kilogram };
-constexpr quantity< dose_equivalent_d       > sievert      { joule / kilogram };
-constexpr quantity< frequency_d             > hertz        { 1 / second };
+PHYS_UNITS_CONSTANT Rep                                 radian       { Rep( 1 ) };
+PHYS_UNITS_CONSTANT Rep                                 steradian    { Rep( 1 ) };
+PHYS_UNITS_CONSTANT quantity< force_d                 > newton       { meter * kilogram / square( second ) };
+PHYS_UNITS_CONSTANT quantity< pressure_d              > pascal       { newton / square( meter ) };
+PHYS_UNITS_CONSTANT quantity< energy_d                > joule        { newton * meter };
+PHYS_UNITS_CONSTANT quantity< power_d                 > watt         { joule / second };
+PHYS_UNITS_CONSTANT quantity< electric_charge_d       > coulomb      { second * ampere };
+PHYS_UNITS_CONSTANT quantity< electric_potential_d    > volt         { watt / ampere };
+PHYS_UNITS_CONSTANT quantity< capacitance_d           > farad        { coulomb / volt };
+PHYS_UNITS_CONSTANT quantity< electric_resistance_d   > ohm          { volt / ampere };
+PHYS_UNITS_CONSTANT quantity< electric_conductance_d  > siemens      { ampere / volt };
+PHYS_UNITS_CONSTANT quantity< magnetic_flux_d         > weber        { volt * second };
+PHYS_UNITS_CONSTANT quantity< magnetic_flux_density_d > tesla        { weber / square( meter ) };
+PHYS_UNITS_CONSTANT quantity< inductance_d            > henry        { weber / ampere };
+PHYS_UNITS_CONSTANT quantity< thermodynamic_temperature_d > degree_celsius   { kelvin };
+PHYS_UNITS_CONSTANT quantity< luminous_flux_d         > lumen        { candela * steradian };
+PHYS_UNITS_CONSTANT quantity< illuminance_d           > lux          { lumen / meter / meter };
+PHYS_UNITS_CONSTANT quantity< activity_of_a_nuclide_d > becquerel    { 1 / second };
+PHYS_UNITS_CONSTANT quantity< absorbed_dose_d         > gray         { joule / kilogram };
+PHYS_UNITS_CONSTANT quantity< dose_equivalent_d       > sievert      { joule / kilogram };
+PHYS_UNITS_CONSTANT quantity< frequency_d             > hertz        { 1 / second };
 
 // The rest of the units approved for use with SI, as specified in SP811.
 // (However, use of these units is generally discouraged.)
 
-constexpr quantity< length_d                > angstrom     { Rep( 1e-10L ) * meter };
-constexpr quantity< area_d                  > are          { Rep( 1e+2L ) * square( meter ) };
-constexpr quantity< pressure_d              > bar          { Rep( 1e+5L ) * pascal };
-constexpr quantity< area_d                  > barn         { Rep( 1e-28L ) * square( meter ) };
-constexpr quantity< activity_of_a_nuclide_d > curie        { Rep( 3.7e+10L ) * becquerel };
-constexpr quantity< time_interval_d         > day          { Rep( 86400L ) * second };
-constexpr Rep                                 degree_angle { pi / 180 };
-constexpr quantity< acceleration_d          > gal          { Rep( 1e-2L ) * meter / square( second ) };
-constexpr quantity< area_d                  > hectare      { Rep( 1e+4L ) * square( meter ) };
-constexpr quantity< time_interval_d         > hour         { Rep( 3600 ) * second };
-constexpr quantity< speed_d                 > knot         { Rep( 1852 ) / 3600 * meter / second };
-constexpr quantity< volume_d                > liter        { Rep( 1e-3L ) * cube( meter ) };
-constexpr quantity< time_interval_d         > minute       { Rep( 60 ) * second };
-constexpr Rep                                 minute_angle { pi / 10800 };
-constexpr quantity< length_d                > mile_nautical{ Rep( 1852 ) * meter };
-constexpr quantity< absorbed_dose_d         > rad          { Rep( 1e-2L ) * gray };
-constexpr quantity< dose_equivalent_d       > rem          { Rep( 1e-2L ) * sievert };
-constexpr quantity< exposure_d              > roentgen     { Rep( 2.58e-4L ) * coulomb / kilogram };
-constexpr Rep                                 second_angle { pi / 648000L };
-constexpr quantity< mass_d                  > ton_metric   { Rep( 1e+3L ) * kilogram };
+PHYS_UNITS_CONSTANT quantity< length_d                > angstrom     { Rep( 1e-10L ) * meter };
+PHYS_UNITS_CONSTANT quantity< area_d                  > are          { Rep( 1e+2L ) * square( meter ) };
+PHYS_UNITS_CONSTANT quantity< pressure_d              > bar          { Rep( 1e+5L ) * pascal };
+PHYS_UNITS_CONSTANT quantity< area_d                  > barn         { Rep( 1e-28L ) * square( meter ) };
+PHYS_UNITS_CONSTANT quantity< activity_of_a_nuclide_d > curie        { Rep( 3.7e+10L ) * becquerel };
+PHYS_UNITS_CONSTANT quantity< time_interval_d         > day          { Rep( 86400L ) * second };
+PHYS_UNITS_CONSTANT Rep                                 degree_angle { pi / 180 };
+PHYS_UNITS_CONSTANT quantity< acceleration_d          > gal          { Rep( 1e-2L ) * meter / square( second ) };
+PHYS_UNITS_CONSTANT quantity< area_d                  > hectare      { Rep( 1e+4L ) * square( meter ) };
+PHYS_UNITS_CONSTANT quantity< time_interval_d         > hour         { Rep( 3600 ) * second };
+PHYS_UNITS_CONSTANT quantity< speed_d                 > knot         { Rep( 1852 ) / 3600 * meter / second };
+PHYS_UNITS_CONSTANT quantity< volume_d                > liter        { Rep( 1e-3L ) * cube( meter ) };
+PHYS_UNITS_CONSTANT quantity< time_interval_d         > minute       { Rep( 60 ) * second };
+PHYS_UNITS_CONSTANT Rep                                 minute_angle { pi / 10800 };
+PHYS_UNITS_CONSTANT quantity< length_d                > mile_nautical{ Rep( 1852 ) * meter };
+PHYS_UNITS_CONSTANT quantity< absorbed_dose_d         > rad          { Rep( 1e-2L ) * gray };
+PHYS_UNITS_CONSTANT quantity< dose_equivalent_d       > rem          { Rep( 1e-2L ) * sievert };
+PHYS_UNITS_CONSTANT quantity< exposure_d              > roentgen     { Rep( 2.58e-4L ) * coulomb / kilogram };
+PHYS_UNITS_CONSTANT Rep                                 second_angle { pi / 648000L };
+PHYS_UNITS_CONSTANT quantity< mass_d                  > ton_metric   { Rep( 1e+3L ) * kilogram };
 
 // Alternate (non-US) spellings:
 
-constexpr quantity< length_d                > metre        { meter };
-constexpr quantity< volume_d                > litre        { liter };
-constexpr Rep                                 deca         { deka };
-constexpr quantity< mass_d                  > tonne        { ton_metric };
+PHYS_UNITS_CONSTANT quantity< length_d                > metre        { meter };
+PHYS_UNITS_CONSTANT quantity< volume_d                > litre        { liter };
+PHYS_UNITS_CONSTANT Rep                                 deca         { deka };
+PHYS_UNITS_CONSTANT quantity< mass_d                  > tonne        { ton_metric };
 
 // cooked literals for base units;
 // these could also have been created with a script.
-
-#define QUANTITY_DEFINE_SCALING_LITERAL( sfx, dim, factor ) \
-    constexpr quantity<dim, long double> operator "" _ ## sfx(unsigned long long x) \
-    { \
-        return quantity<dim, long double>( detail::magnitude_tag, factor * x ); \
-    } \
-    constexpr quantity<dim, long double> operator "" _ ## sfx(long double x) \
-    { \
-        return quantity<dim, long double>( detail::magnitude_tag, factor * x ); \
-    }
-
-#define QUANTITY_DEFINE_SCALING_LITERALS( pfx, dim, fact ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( Y ## pfx, dim, fact * yotta ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( Z ## pfx, dim, fact * zetta ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( E ## pfx, dim, fact * exa   ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( P ## pfx, dim, fact * peta  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( T ## pfx, dim, fact * tera  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( G ## pfx, dim, fact * giga  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( M ## pfx, dim, fact * mega  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( k ## pfx, dim, fact * kilo  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( h ## pfx, dim, fact * hecto ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( da## pfx, dim, fact * deka  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL(      pfx, dim, fact * 1     ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( d ## pfx, dim, fact * deci  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( c ## pfx, dim, fact * centi ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( m ## pfx, dim, fact * milli ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( u ## pfx, dim, fact * micro ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( n ## pfx, dim, fact * nano  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( p ## pfx, dim, fact * pico  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( f ## pfx, dim, fact * femto ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( a ## pfx, dim, fact * atto  ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( z ## pfx, dim, fact * zepto ) \
-    QUANTITY_DEFINE_SCALING_LITERAL( y ## pfx, dim, fact * yocto )
-
-
-#define QUANTITY_DEFINE_LITERALS( pfx, dim ) \
-    QUANTITY_DEFINE_SCALING_LITERALS( pfx, dim, 1 )
+//
+// The literals yield quantity<dim, LiteralRep>, Rep by default; define
+// PHYS_UNITS_LITERAL_TYPE to change it. The same literals yielding float
+// are in namespace literals::float_literals. The prefix factor is applied
+// in long double and the result is rounded once to the target type; in a
+// constant expression this happens at compile time. The macros that define
+// them are in quantity_macros.hpp.
 
 /// literals
 
@@ -0,0 +1,318 @@
+/**
+ * \file quantity_accumulator.hpp
+ *
+ * \brief   Accurate summation of quantities in a wider or compensated representation.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Summing many quantity<Dims, float> with operator+= loses precision once
+ * the total is much larger than the terms. A quantity_accumulator keeps
+ * the running total in AccumRep (double for float storage by default) and
+ * uses one of the following summation modes:
+ *
+ * - accumulation::plain    - straight summation in AccumRep.
+ * - accumulation::kahan    - Kahan compensated summation.
+ * - accumulation::neumaier - Neumaier's improved Kahan summation (default);
+ *                            also exact when a term is larger than the total.
+ * - accumulation::pairwise - cascaded pairwise summation over blocks;
+ *                            error grows with log(n), no extra operations per term.
+ *
+ * The compensated modes rely on strict floating point semantics;
+ * they do not work with -ffast-math or /fp:fast.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_ACCUMULATOR_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_ACCUMULATOR_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cstddef>
+#include <iterator>
+
+/*
+ * Number of terms summed directly before pairwise summation combines them.
+ */
+#ifndef PHYS_UNITS_PAIRWISE_BLOCK
+# define PHYS_UNITS_PAIRWISE_BLOCK 64
+#endif
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/// namespace accumulation.
+
+namespace accumulation {
+
+/*
+ * Summation modes; each provides state<T> with add(x) and total().
+ */
+
+/**
+ * straight summation.
+ */
+struct plain
+{
+    template< typename T >
+    struct state
+    {
+        T sum = T( 0 );
+
+        void add( T const x ) { sum += x; }
+
+        T total() const { return sum; }
+    };
+};
+
+/**
+ * Kahan compensated summation.
+ */
+struct kahan
+{
+    template< typename T >
+    struct state
+    {
+        T sum = T( 0 );
+        T c   = T( 0 );
+
+        void add( T const x )
+        {
+            T const y = x - c;
+            T const t = sum + y;
+
+            c   = ( t - sum ) - y;
+            sum = t;
+        }
+
+        T total() const { return sum; }
+    };
+};
+
+/**
+ * Neumaier compensated summation.
+ */
+struct neumaier
+{
+    template< typename T >
+    struct state
+    {
+        T sum = T( 0 );
+        T c   = T( 0 );
+
+        void add( T const x )
+        {
+            T const t = sum + x;
+
+            if ( ( sum < 0 ? -sum : sum ) >= ( x < 0 ? -x : x ) )
+            {
+                c += ( sum - t ) + x;
+            }
+            else
+            {
+                c += ( x - t ) + sum;
+            }
+
+            sum = t;
+        }
+
+        T total() const { return sum + c; }
+    };
+};
+
+/**
+ * cascaded pairwise summation: terms are summed in blocks of
+ * PHYS_UNITS_PAIRWISE_BLOCK and the block sums are combined as a
+ * binary tree, level[i] holding the sum of 2^i blocks.
+ */
+struct pairwise
+{
+    template< typename T >
+    struct state
+    {
+        enum { levels = 64 };
+
+        T           block = T( 0 );
+        std::size_t in_block = 0;
+        std::size_t blocks = 0;
+        T           level[ levels ] = {};
+
+        void add( T const x )
+        {
+            block += x;
+
+            if ( ++in_block == PHYS_UNITS_PAIRWISE_BLOCK )
+            {
+                T carry = block;
+                std::size_t i = 0;
+
+                for ( ; blocks & ( std::size_t( 1 ) << i ); ++i )
+                {
+                    carry += level[i];
+                    level[i] = T( 0 );
+                }
+
+                level[i] = carry;
+
+                ++blocks;
+                block = T( 0 );
+                in_block = 0;
+            }
+        }
+
+        T total() const
+        {
+            T sum = block;
+
+            for ( std::size_t i = 0; i < levels; ++i )
+            {
+                sum += level[i];
+            }
+
+            return sum;
+        }
+    };
+};
+
+} // namespace accumulation
+
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * default type to accumulate a magnitude of type T in.
+ */
+template< typename T >
+struct accumulate_type
+{
+    typedef T type;
+};
+
+template<>
+struct accumulate_type< float >
+{
+    typedef double type;
+};
+
+template< typename T >
+using AccumulateType = typename accumulate_type<T>::type;
+
+} // namespace detail
+
+/**
+ * \brief accumulator that sums quantity<Dims, StorageRep> in AccumRep,
+ * using summation Mode.
+ */
+template<
+    typename Dims,
+    typename StorageRep = Rep,
+    typename AccumRep = detail::AccumulateType<StorageRep>,
+    typename Mode = accumulation::neumaier >
+class quantity_accumulator
+{
+public:
+    typedef Dims dimension_type;
+
+    typedef quantity<Dims, StorageRep> value_type;
+
+    typedef quantity<Dims, AccumRep> result_type;
+
+    typedef Mode mode_type;
+
+    /**
+     * default constructor, the total is zero.
+     */
+    quantity_accumulator() : m_state(), m_count( 0 ) { }
+
+    /**
+     * add a quantity to the total.
+     */
+    template< typename X >
+    quantity_accumulator & operator+=( quantity<Dims, X> const & q )
+    {
+        m_state.add( AccumRep( q.magnitude() ) );
+        ++m_count;
+        return *this;
+    }
+
+    /**
+     * add the quantities in [first, last) to the total.
+     */
+    template< typename InputIt >
+    quantity_accumulator & add( InputIt first, InputIt const last )
+    {
+        for ( ; first != last; ++first )
+        {
+            *this += *first;
+        }
+        return *this;
+    }
+
+    /**
+     * the total so far.
+     */
+    result_type total() const
+    {
+        return result_type( detail::magnitude_tag, m_state.total() );
+    }
+
+    /**
+     * the number of quantities added so far.
+     */
+    std::size_t count() const { return m_count; }
+
+    /**
+     * restart from a zero total.
+     */
+    void reset() { *this = quantity_accumulator(); }
+
+private:
+    typename Mode::template state<AccumRep> m_state;
+    std::size_t m_count;
+};
+
+/**
+ * accumulator for the quantity type Q, e.g. Accumulator< quantity<energy_d, float> >.
+ */
+template< typename Q, typename Mode = accumulation::neumaier >
+struct accumulator_for;
+
+template< typename D, typename T, typename Mode >
+struct accumulator_for< quantity<D, T>, Mode >
+{
+    typedef quantity_accumulator< D, T, detail::AccumulateType<T>, Mode > type;
+};
+
+template< typename Q, typename Mode = accumulation::neumaier >
+using Accumulator = typename accumulator_for<Q, Mode>::type;
+
+/**
+ * sum the quantities in [first, last) accurately, using Mode.
+ */
+template< typename Mode = accumulation::neumaier, typename InputIt >
+typename Accumulator< typename std::iterator_traits<InputIt>::value_type, Mode >::result_type
+accumulate( InputIt const first, InputIt const last )
+{
+    return Accumulator< typename std::iterator_traits<InputIt>::value_type, Mode >().add( first, last ).total();
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_ACCUMULATOR_HPP_INCLUDED
+
+/*
+ * end of file
+ */
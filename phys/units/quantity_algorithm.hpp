@@ -0,0 +1,409 @@
+/**
+ * \file quantity_algorithm.hpp
+ *
+ * \brief   Parallel, dimension-checked reductions over spans and arrays of quantities.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * The reductions sum(), mean(), rms(), min(), max() and dot() accept a
+ * quantity_span, a quantity_array or an element-wise expression, e.g.
+ * sum( v * dt ), and derive the dimension of their result as the quantity
+ * operators do: dot() of forces and lengths gives an energy.
+ *
+ * Sums are accumulated in detail::AccumulateType (double for float) in
+ * eight independent partial sums, which hides the latency of the additions.
+ * For compensated summation, see quantity_accumulator.hpp.
+ *
+ * Large inputs are split over std::thread's; threads is the number of
+ * threads to use, 0 for std::thread::hardware_concurrency(). A thread
+ * handles at least PHYS_UNITS_PARALLEL_GRAIN elements. Link with -pthread.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_ALGORITHM_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_ALGORITHM_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_accumulator.hpp"
+#include "phys/units/quantity_array.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+/*
+ * Minimum number of elements per thread of a reduction.
+ */
+#ifndef PHYS_UNITS_PARALLEL_GRAIN
+# define PHYS_UNITS_PARALLEL_GRAIN 65536
+#endif
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * number of threads to reduce n elements with.
+ */
+inline unsigned thread_count( std::size_t const n, unsigned const threads )
+{
+    std::size_t const wanted = threads ? threads : std::max( 1u, std::thread::hardware_concurrency() );
+    std::size_t const useful = std::max( std::size_t( 1 ), n / PHYS_UNITS_PARALLEL_GRAIN );
+
+    return unsigned( std::min( wanted, useful ) );
+}
+
+/**
+ * joins the threads of a pool on leaving scope, also when unwinding, as
+ * destroying a joinable std::thread calls std::terminate().
+ */
+class join_guard
+{
+public:
+    explicit join_guard( std::vector<std::thread> & pool )
+    : pool( pool ) { }
+
+    ~join_guard()
+    {
+        for ( auto & thread : pool )
+        {
+            if ( thread.joinable() )
+            {
+                thread.join();
+            }
+        }
+    }
+
+    join_guard( join_guard const & ) = delete;
+    join_guard & operator=( join_guard const & ) = delete;
+
+private:
+    std::vector<std::thread> & pool;
+};
+
+/**
+ * reduce [0,n) by applying f(first, last) to contiguous, non-empty chunks,
+ * one per thread, and combining the chunk results with combine(x, y).
+ * An exception from f, or from starting a thread, propagates to the caller
+ * after all started threads have finished.
+ */
+template< typename A, typename F, typename C >
+A parallel_reduce( std::size_t const n, unsigned const threads, F f, C combine )
+{
+    unsigned const t = thread_count( n, threads );
+
+    if ( t <= 1 )
+    {
+        return f( std::size_t( 0 ), n );
+    }
+
+    // chunks of n / t elements, the first n % t of them one more:
+
+    auto const start = [n, t]( std::size_t const j )
+    {
+        return j * ( n / t ) + std::min<std::size_t>( j, n % t );
+    };
+
+    std::vector<A> partial( t );
+    std::vector<std::exception_ptr> error( t );
+    std::vector<std::thread> pool;
+    pool.reserve( t - 1 );
+
+    {
+        join_guard guard( pool );
+
+        for ( unsigned j = 1; j < t; ++j )
+        {
+            std::size_t const first = start( j     );
+            std::size_t const last  = start( j + 1 );
+
+            pool.emplace_back( [&partial, &error, &f, j, first, last]()
+            {
+                try
+                {
+                    partial[j] = f( first, last );
+                }
+                catch ( ... )
+                {
+                    error[j] = std::current_exception();
+                }
+            } );
+        }
+
+        partial[0] = f( std::size_t( 0 ), start( 1 ) );
+    }
+
+    for ( auto const & e : error )
+    {
+        if ( e )
+        {
+            std::rethrow_exception( e );
+        }
+    }
+
+    A result = partial[0];
+
+    for ( unsigned j = 1; j < t; ++j )
+    {
+        result = combine( result, partial[j] );
+    }
+
+    return result;
+}
+
+/**
+ * sum of f(i) for i in [first,last) in eight independent partial sums;
+ * named locals stay in registers, where an array of partial sums does not.
+ */
+template< typename A, typename F >
+A blocked_sum( std::size_t const first, std::size_t const last, F f )
+{
+    A s0 = A( 0 ), s1 = A( 0 ), s2 = A( 0 ), s3 = A( 0 );
+    A s4 = A( 0 ), s5 = A( 0 ), s6 = A( 0 ), s7 = A( 0 );
+
+    std::size_t const n = last - first;
+    std::size_t const blocked = n - n % 8;
+
+    std::size_t i = 0;
+
+    for ( ; i < blocked; i += 8 )
+    {
+        s0 += f( first + i     );
+        s1 += f( first + i + 1 );
+        s2 += f( first + i + 2 );
+        s3 += f( first + i + 3 );
+        s4 += f( first + i + 4 );
+        s5 += f( first + i + 5 );
+        s6 += f( first + i + 6 );
+        s7 += f( first + i + 7 );
+    }
+
+    for ( ; i < n; ++i )
+    {
+        s0 += f( first + i );
+    }
+
+    return ( ( s0 + s1 ) + ( s2 + s3 ) ) + ( ( s4 + s5 ) + ( s6 + s7 ) );
+}
+
+/**
+ * extreme of f(i) for i in [first,last), first < last, in four partial
+ * extremes; prefer( x, y ) is true if x is preferred, e.g. x < y for the minimum.
+ */
+template< typename A, typename F, typename Prefer >
+A blocked_extreme( std::size_t const first, std::size_t const last, F f, Prefer prefer )
+{
+    A e0 = f( first ), e1 = e0, e2 = e0, e3 = e0;
+
+    std::size_t const n = last - first;
+    std::size_t const blocked = n - n % 4;
+
+    std::size_t i = 0;
+
+    for ( ; i < blocked; i += 4 )
+    {
+        A const x0 = f( first + i     ); e0 = prefer( x0, e0 ) ? x0 : e0;
+        A const x1 = f( first + i + 1 ); e1 = prefer( x1, e1 ) ? x1 : e1;
+        A const x2 = f( first + i + 2 ); e2 = prefer( x2, e2 ) ? x2 : e2;
+        A const x3 = f( first + i + 3 ); e3 = prefer( x3, e3 ) ? x3 : e3;
+    }
+
+    for ( ; i < n; ++i )
+    {
+        A const x = f( first + i ); e0 = prefer( x, e0 ) ? x : e0;
+    }
+
+    e0 = prefer( e1, e0 ) ? e1 : e0;
+    e2 = prefer( e3, e2 ) ? e3 : e2;
+
+    return prefer( e2, e0 ) ? e2 : e0;
+}
+
+/**
+ * element type, magnitude type and accumulation type of a range.
+ */
+template< typename R >
+using ElementOf = typename LeafOf<R>::value_type;
+
+template< typename R >
+using MagnitudeOf = typename ElementOf<R>::value_type;
+
+template< typename R >
+using AccumulateOf = AccumulateType< MagnitudeOf<R> >;
+
+template< typename R >
+using DimensionOf = typename ElementOf<R>::dimension_type;
+
+/**
+ * sum of the magnitudes of a range in its accumulation type.
+ */
+template< typename R >
+AccumulateOf<R> magnitude_sum( R const & r, unsigned const threads )
+{
+    typedef AccumulateOf<R> A;
+
+    LeafOf<R> const e = make_leaf( r );
+
+    return parallel_reduce<A>( e.size(), threads,
+        [e]( std::size_t first, std::size_t last )
+        {
+            return blocked_sum<A>( first, last, [e]( std::size_t i ) { return A( e[i].magnitude() ); } );
+        },
+        []( A x, A y ) { return x + y; } );
+}
+
+} // namespace detail
+
+/**
+ * sum of the elements; zero for an empty range.
+ */
+template< typename R >
+detail::EnableIfRange<R, quantity< detail::DimensionOf<R>, detail::AccumulateOf<R> >>
+sum( R const & r, unsigned const threads = 0 )
+{
+    return quantity< detail::DimensionOf<R>, detail::AccumulateOf<R> >(
+        detail::magnitude_tag, detail::magnitude_sum( r, threads ) );
+}
+
+/**
+ * arithmetic mean of the elements of a non-empty range.
+ */
+template< typename R >
+detail::EnableIfRange<R, quantity< detail::DimensionOf<R>, detail::AccumulateOf<R> >>
+mean( R const & r, unsigned const threads = 0 )
+{
+    assert( detail::make_leaf( r ).size() > 0 );
+
+    return sum( r, threads ) / detail::AccumulateOf<R>( detail::make_leaf( r ).size() );
+}
+
+/**
+ * root mean square of the elements of a non-empty range; same dimension.
+ */
+template< typename R >
+detail::EnableIfRange<R, quantity< detail::DimensionOf<R>, detail::AccumulateOf<R> >>
+rms( R const & r, unsigned const threads = 0 )
+{
+    typedef detail::AccumulateOf<R> A;
+
+    detail::LeafOf<R> const e = detail::make_leaf( r );
+
+    assert( e.size() > 0 );
+
+    A const squares = detail::parallel_reduce<A>( e.size(), threads,
+        [e]( std::size_t first, std::size_t last )
+        {
+            return detail::blocked_sum<A>( first, last,
+                [e]( std::size_t i ) { A const x = A( e[i].magnitude() ); return x * x; } );
+        },
+        []( A x, A y ) { return x + y; } );
+
+    using std::sqrt;
+
+    return quantity< detail::DimensionOf<R>, A >( detail::magnitude_tag, sqrt( squares / A( e.size() ) ) );
+}
+
+/**
+ * smallest element of a non-empty range.
+ */
+template< typename R >
+detail::EnableIfRange<R, detail::ElementOf<R>>
+min( R const & r, unsigned const threads = 0 )
+{
+    typedef detail::ElementOf<R> Q;
+
+    detail::LeafOf<R> const e = detail::make_leaf( r );
+
+    assert( e.size() > 0 );
+
+    auto const less = []( Q const & x, Q const & y ) { return x < y; };
+
+    return detail::parallel_reduce<Q>( e.size(), threads,
+        [e, less]( std::size_t first, std::size_t last )
+        {
+            return detail::blocked_extreme<Q>( first, last, [e]( std::size_t i ) { return Q( e[i] ); }, less );
+        },
+        [less]( Q const & x, Q const & y ) { return less( y, x ) ? y : x; } );
+}
+
+/**
+ * largest element of a non-empty range.
+ */
+template< typename R >
+detail::EnableIfRange<R, detail::ElementOf<R>>
+max( R const & r, unsigned const threads = 0 )
+{
+    typedef detail::ElementOf<R> Q;
+
+    detail::LeafOf<R> const e = detail::make_leaf( r );
+
+    assert( e.size() > 0 );
+
+    auto const greater = []( Q const & x, Q const & y ) { return y < x; };
+
+    return detail::parallel_reduce<Q>( e.size(), threads,
+        [e, greater]( std::size_t first, std::size_t last )
+        {
+            return detail::blocked_extreme<Q>( first, last, [e]( std::size_t i ) { return Q( e[i] ); }, greater );
+        },
+        [greater]( Q const & x, Q const & y ) { return greater( y, x ) ? y : x; } );
+}
+
+/**
+ * dot product of two ranges of equal size; the dimensions multiply,
+ * e.g. the dot product of forces and lengths is an energy.
+ */
+template< typename RX, typename RY >
+detail::EnableIfRanges< RX, RY, detail::Product<
+    detail::DimensionOf<RX>, detail::DimensionOf<RY>,
+    detail::AccumulateType< detail::PromoteMul< detail::MagnitudeOf<RX>, detail::MagnitudeOf<RY> > >,
+    detail::AccumulateType< detail::PromoteMul< detail::MagnitudeOf<RX>, detail::MagnitudeOf<RY> > > > >
+dot( RX const & x, RY const & y, unsigned const threads = 0 )
+{
+    typedef detail::AccumulateType< detail::PromoteMul< detail::MagnitudeOf<RX>, detail::MagnitudeOf<RY> > > A;
+
+    typedef detail::Product< detail::DimensionOf<RX>, detail::DimensionOf<RY>, A, A > result_type;
+
+    detail::LeafOf<RX> const ex = detail::make_leaf( x );
+    detail::LeafOf<RY> const ey = detail::make_leaf( y );
+
+    assert( ex.size() == ey.size() );
+
+    A const d = detail::parallel_reduce<A>( ex.size(), threads,
+        [ex, ey]( std::size_t first, std::size_t last )
+        {
+            return detail::blocked_sum<A>( first, last,
+                [ex, ey]( std::size_t i ) { return A( ex[i].magnitude() ) * A( ey[i].magnitude() ); } );
+        },
+        []( A a, A b ) { return a + b; } );
+
+    return detail::from_magnitude<result_type>::make( d );
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_ALGORITHM_HPP_INCLUDED
+
+/*
+ * end of file
+ */
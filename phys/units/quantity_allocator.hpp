@@ -0,0 +1,126 @@
+/**
+ * \file quantity_allocator.hpp
+ *
+ * \brief   Allocator adaptor that leaves default-constructed quantities uninitialized.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * quantity() zeroes its magnitude, so std::vector<quantity<D>>( n ) and
+ * resize( n ) write every element before the program does. For a buffer
+ * that is overwritten next, this is a wasted pass over memory that also
+ * takes the page faults of fresh memory.
+ *
+ * A container with a no_init_allocator constructs a quantity without
+ * arguments via quantity( no_init ), and any other type by default
+ * initialization, which leaves numbers uninitialized; construction with
+ * arguments, e.g. std::vector( n, q ), is that of the underlying allocator.
+ * See also quantity_array( n, no_init ) in quantity_array.hpp.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_ALLOCATOR_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_ALLOCATOR_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/**
+ * \brief allocator A with construction without arguments that does not initialize.
+ */
+template< typename T, typename A = std::allocator<T> >
+class no_init_allocator : public A
+{
+    typedef std::allocator_traits<A> traits;
+
+public:
+    template< typename U >
+    struct rebind
+    {
+        typedef no_init_allocator< U, typename traits::template rebind_alloc<U> > other;
+    };
+
+    using A::A;
+
+    no_init_allocator() = default;
+
+    /**
+     * converting copy constructor, for rebound allocators.
+     */
+    template< typename U, typename B >
+    no_init_allocator( no_init_allocator<U, B> const & other ) noexcept
+    : A( static_cast<B const &>( other ) ) { }
+
+    /**
+     * construct without arguments: uninitialized.
+     */
+    template< typename U >
+    void construct( U * p ) noexcept( std::is_nothrow_default_constructible<U>::value )
+    {
+        construct_uninitialized( p, detail::is_quantity<U>() );
+    }
+
+    /**
+     * construct with arguments: as A does.
+     */
+    template< typename U, typename... Args >
+    void construct( U * p, Args &&... args )
+    {
+        traits::construct( static_cast<A &>( *this ), p, std::forward<Args>( args )... );
+    }
+
+private:
+    template< typename U >
+    static void construct_uninitialized( U * p, std::true_type )
+    {
+        ::new( static_cast<void *>( p ) ) U( no_init );
+    }
+
+    template< typename U >
+    static void construct_uninitialized( U * p, std::false_type )
+    {
+        ::new( static_cast<void *>( p ) ) U;
+    }
+};
+
+/**
+ * no_init_allocators compare as their underlying allocators.
+ */
+template< typename T, typename A, typename U, typename B >
+bool operator==( no_init_allocator<T, A> const & x, no_init_allocator<U, B> const & y ) noexcept
+{
+    return static_cast<A const &>( x ) == static_cast<B const &>( y );
+}
+
+template< typename T, typename A, typename U, typename B >
+bool operator!=( no_init_allocator<T, A> const & x, no_init_allocator<U, B> const & y ) noexcept
+{
+    return !( x == y );
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_ALLOCATOR_HPP_INCLUDED
+
+/*
+ * end of file
+ */
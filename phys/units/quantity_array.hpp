@@ -0,0 +1,1162 @@
+/**
+ * \file quantity_array.hpp
+ *
+ * \brief   Aligned arrays and spans of quantities that share a single compile-time dimension.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * A quantity_array<Dims, T> stores its magnitudes contiguously in a buffer
+ * aligned to PHYS_UNITS_ARRAY_ALIGNMENT bytes; the dimension lives in the type,
+ * not in the elements.
+ *
+ * Element-wise arithmetic on arrays and spans yields a quantity_expression
+ * that only records the operation. The expression is evaluated in a single
+ * pass when it is assigned to an array or span, so x = x0 + v * dt creates
+ * no temporary arrays. The loop runs in fixed-size blocks that the compiler
+ * vectorizes at -O2.
+ *
+ * An expression refers to the arrays it was built from; evaluate it before
+ * these go out of scope, or use eval() to obtain an array.
+ *
+ * A quantity_span can also view an existing buffer of magnitudes, such as a
+ * double* from a file reader or MPI, as quantities without copying it, and
+ * magnitudes() views the elements of a span or array as plain numbers.
+ * This relies on detail::has_magnitude_layout, see quantity.hpp.
+ *
+ * convert() expresses all elements of a span or array in a given unit at once.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_ARRAY_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_ARRAY_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+
+/*
+ * Alignment in bytes of the storage of quantity_array; a cache line by default.
+ */
+#ifndef PHYS_UNITS_ARRAY_ALIGNMENT
+# define PHYS_UNITS_ARRAY_ALIGNMENT 64
+#endif
+
+/*
+ * Number of elements processed per unrolled block of the element-wise loops.
+ */
+#ifndef PHYS_UNITS_SIMD_BLOCK
+# define PHYS_UNITS_SIMD_BLOCK 16
+#endif
+
+/*
+ * Tell the compiler that iterations of the next loop are independent.
+ */
+#if defined(__clang__)
+# define PHYS_UNITS_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+# define PHYS_UNITS_IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+# define PHYS_UNITS_IVDEP __pragma(loop(ivdep))
+#else
+# define PHYS_UNITS_IVDEP
+#endif
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/*
+ * declare now, define later.
+ */
+template< typename Dims, typename T = Rep >
+class quantity_span;
+
+template< typename Dims, typename T = Rep >
+class quantity_array;
+
+template< typename E >
+class quantity_expression;
+
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * largest number of elements of the given size that aligned_allocate() can
+ * provide without overflow of the size of the block with its overhead.
+ */
+inline std::size_t aligned_max_count( std::size_t size, std::size_t alignment )
+{
+    return ( SIZE_MAX - alignment - sizeof( void * ) ) / size;
+}
+
+/**
+ * allocate bytes aligned to alignment (a power of two);
+ * the original pointer is kept just before the aligned block.
+ */
+inline void * aligned_allocate( std::size_t bytes, std::size_t alignment )
+{
+    if ( bytes > aligned_max_count( 1, alignment ) )
+    {
+        throw std::bad_alloc();
+    }
+
+    void * raw = std::malloc( bytes + alignment + sizeof( void * ) );
+
+    if ( raw == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+
+    std::uintptr_t p = reinterpret_cast<std::uintptr_t>( raw ) + sizeof( void * );
+    p = ( p + alignment - 1 ) & ~std::uintptr_t( alignment - 1 );
+
+    reinterpret_cast<void **>( p )[-1] = raw;
+
+    return reinterpret_cast<void *>( p );
+}
+
+/**
+ * release memory obtained from aligned_allocate().
+ */
+inline void aligned_deallocate( void * p )
+{
+    if ( p != nullptr )
+    {
+        std::free( static_cast<void **>( p )[-1] );
+    }
+}
+
+/**
+ * call f(i) for i in [0,n); full blocks of PHYS_UNITS_SIMD_BLOCK
+ * iterations have a constant trip count so that they vectorize.
+ */
+template< typename F >
+inline void for_each_index( std::size_t const n, F f )
+{
+    std::size_t const blocked = n - n % PHYS_UNITS_SIMD_BLOCK;
+
+    std::size_t i = 0;
+
+    for ( ; i < blocked; i += PHYS_UNITS_SIMD_BLOCK )
+    {
+        PHYS_UNITS_IVDEP
+        for ( std::size_t k = 0; k < PHYS_UNITS_SIMD_BLOCK; ++k )
+        {
+            f( i + k );
+        }
+    }
+
+    for ( ; i < n; ++i )
+    {
+        f( i );
+    }
+}
+
+/**
+ * quantity_span, quantity_array and quantity_expression are ranges.
+ */
+template< typename D, typename T >
+struct is_quantity_range< quantity_span<D, T> > : std::true_type { };
+
+template< typename D, typename T >
+struct is_quantity_range< quantity_array<D, T> > : std::true_type { };
+
+template< typename E >
+struct is_quantity_range< quantity_expression<E> > : std::true_type { };
+
+template< typename T >
+struct is_quantity_expression : std::false_type { };
+
+template< typename E >
+struct is_quantity_expression< quantity_expression<E> > : std::true_type { };
+
+/**
+ * array type to hold the results of an element-wise operation;
+ * there is none for dimensionless results.
+ */
+template< typename Q >
+struct array_of { };
+
+template< typename D, typename T >
+struct array_of< quantity<D, T> >
+{
+    typedef quantity_array<D, T> type;
+};
+
+template< typename Q >
+using ArrayOf = typename array_of<Q>::type;
+
+template< typename RX, typename R >
+using EnableIfRange = typename std::enable_if< is_quantity_range<RX>::value, R >::type;
+
+template< typename RX, typename RY, typename R >
+using EnableIfRanges = typename std::enable_if<
+    is_quantity_range<RX>::value && is_quantity_range<RY>::value, R >::type;
+
+template< typename RX, typename Y, typename R >
+using EnableIfRangeScalar = typename std::enable_if<
+    is_quantity_range<RX>::value && !is_quantity_range<Y>::value, R >::type;
+
+template< typename RX, typename Y, typename R >
+using EnableIfRangeNumber = typename std::enable_if<
+    is_quantity_range<RX>::value && std::is_arithmetic<Y>::value, R >::type;
+
+/*
+ * Expression nodes; each provides value_type, size() and operator[](i).
+ * A scalar operand is broadcast to all elements and has no size of its own.
+ */
+
+/**
+ * leaf that refers to the elements of a span or an array.
+ */
+template< typename Q >
+struct range_leaf
+{
+    typedef Q value_type;
+
+    enum { is_scalar = false };
+
+    Q const *   data;
+    std::size_t count;
+
+    std::size_t size() const { return count; }
+
+    Q const & operator[]( std::size_t const i ) const { return data[i]; }
+};
+
+/**
+ * leaf that holds a number or a quantity.
+ */
+template< typename S >
+struct scalar_leaf
+{
+    typedef S value_type;
+
+    enum { is_scalar = true };
+
+    S value;
+
+    std::size_t size() const { return 0; }
+
+    S const & operator[]( std::size_t const ) const { return value; }
+};
+
+/**
+ * element-wise operations; result types follow the quantity operators,
+ * including the promotion policy.
+ */
+struct negate
+{
+    template< typename X >
+    using result = decltype( -std::declval<X>() );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return -x; }
+};
+
+struct plus
+{
+    template< typename X, typename Y >
+    using result = decltype( std::declval<X>() + std::declval<Y>() );
+
+    template< typename X, typename Y >
+    static result<X, Y> apply( X const & x, Y const & y ) { return x + y; }
+};
+
+struct minus
+{
+    template< typename X, typename Y >
+    using result = decltype( std::declval<X>() - std::declval<Y>() );
+
+    template< typename X, typename Y >
+    static result<X, Y> apply( X const & x, Y const & y ) { return x - y; }
+};
+
+struct multiplies
+{
+    template< typename X, typename Y >
+    using result = decltype( std::declval<X>() * std::declval<Y>() );
+
+    template< typename X, typename Y >
+    static result<X, Y> apply( X const & x, Y const & y ) { return x * y; }
+};
+
+struct divides
+{
+    template< typename X, typename Y >
+    using result = decltype( std::declval<X>() / std::declval<Y>() );
+
+    template< typename X, typename Y >
+    static result<X, Y> apply( X const & x, Y const & y ) { return x / y; }
+};
+
+/**
+ * node applying Op to the elements of one operand.
+ */
+template< typename Op, typename E >
+struct unary_node
+{
+    typedef typename Op::template result< typename E::value_type > value_type;
+
+    enum { is_scalar = false };
+
+    E e;
+
+    std::size_t size() const { return e.size(); }
+
+    value_type operator[]( std::size_t const i ) const { return Op::apply( e[i] ); }
+};
+
+/**
+ * node applying Op to the elements of two operands.
+ */
+template< typename Op, typename L, typename R >
+struct binary_node
+{
+    typedef typename Op::template result< typename L::value_type, typename R::value_type > value_type;
+
+    enum { is_scalar = false };
+
+    L l;
+    R r;
+
+    std::size_t size() const
+    {
+        return L::is_scalar ? r.size() : l.size();
+    }
+
+    value_type operator[]( std::size_t const i ) const { return Op::apply( l[i], r[i] ); }
+};
+
+/**
+ * node applying Op to the elements of three operands.
+ */
+template< typename Op, typename X, typename Y, typename Z >
+struct ternary_node
+{
+    typedef typename Op::template result< typename X::value_type, typename Y::value_type, typename Z::value_type > value_type;
+
+    enum { is_scalar = false };
+
+    X x;
+    Y y;
+    Z z;
+
+    std::size_t size() const
+    {
+        return !X::is_scalar ? x.size() : !Y::is_scalar ? y.size() : z.size();
+    }
+
+    value_type operator[]( std::size_t const i ) const { return Op::apply( x[i], y[i], z[i] ); }
+};
+
+/**
+ * convert an operand to an expression node.
+ */
+template< typename S >
+struct leaf_of
+{
+    typedef scalar_leaf<S> type;
+
+    static type make( S const & s ) { return type{ s }; }
+};
+
+template< typename D, typename T >
+struct leaf_of< quantity_span<D, T> >
+{
+    typedef range_leaf< quantity<D, typename std::remove_const<T>::type> > type;
+
+    static type make( quantity_span<D, T> const & s ) { return type{ s.data(), s.size() }; }
+};
+
+template< typename D, typename T >
+struct leaf_of< quantity_array<D, T> >
+{
+    typedef range_leaf< quantity<D, T> > type;
+
+    static type make( quantity_array<D, T> const & a ) { return type{ a.data(), a.size() }; }
+};
+
+template< typename E >
+struct leaf_of< quantity_expression<E> >
+{
+    typedef E type;
+
+    static type make( quantity_expression<E> const & x ) { return x.node(); }
+};
+
+template< typename X >
+using LeafOf = typename leaf_of<X>::type;
+
+template< typename X >
+LeafOf<X> make_leaf( X const & x )
+{
+    return leaf_of<X>::make( x );
+}
+
+template< typename Op, typename X >
+using Unary = quantity_expression< unary_node< Op, LeafOf<X> > >;
+
+template< typename Op, typename X, typename Y >
+using Binary = quantity_expression< binary_node< Op, LeafOf<X>, LeafOf<Y> > >;
+
+template< typename Op, typename X, typename Y >
+Binary<Op, X, Y> make_binary( X const & x, Y const & y )
+{
+    typedef binary_node< Op, LeafOf<X>, LeafOf<Y> > node;
+
+    assert( LeafOf<X>::is_scalar || LeafOf<Y>::is_scalar || make_leaf( x ).size() == make_leaf( y ).size() );
+
+    return Binary<Op, X, Y>( node{ make_leaf( x ), make_leaf( y ) } );
+}
+
+template< typename Op, typename X, typename Y, typename Z >
+using Ternary = quantity_expression< ternary_node< Op, LeafOf<X>, LeafOf<Y>, LeafOf<Z> > >;
+
+template< typename Op, typename X, typename Y, typename Z >
+Ternary<Op, X, Y, Z> make_ternary( X const & x, Y const & y, Z const & z )
+{
+    typedef ternary_node< Op, LeafOf<X>, LeafOf<Y>, LeafOf<Z> > node;
+
+    node const e{ make_leaf( x ), make_leaf( y ), make_leaf( z ) };
+
+    assert( LeafOf<X>::is_scalar || e.x.size() == e.size() );
+    assert( LeafOf<Y>::is_scalar || e.y.size() == e.size() );
+    assert( LeafOf<Z>::is_scalar || e.z.size() == e.size() );
+
+    return Ternary<Op, X, Y, Z>( e );
+}
+
+/**
+ * assignment of an element, plain or compound.
+ */
+struct assign       { template< typename Q, typename X > static void apply( Q & q, X const & x ) { q  = x; } };
+struct plus_assign  { template< typename Q, typename X > static void apply( Q & q, X const & x ) { q += x; } };
+struct minus_assign { template< typename Q, typename X > static void apply( Q & q, X const & x ) { q -= x; } };
+struct times_assign { template< typename Q, typename X > static void apply( Q & q, X const & x ) { q *= x; } };
+struct div_assign   { template< typename Q, typename X > static void apply( Q & q, X const & x ) { q /= x; } };
+
+/**
+ * evaluate the expression node e into out[0..n) in a single pass.
+ * out may be one of the operands of e, but must not partially overlap them.
+ */
+template< typename Assign, typename Q, typename E >
+void evaluate( Q * out, std::size_t const n, E const e )
+{
+    assert( E::is_scalar || e.size() == n );
+
+    for_each_index( n, [out, e]( std::size_t i ) { Assign::apply( out[i], e[i] ); } );
+}
+
+/**
+ * scale a magnitude to a unit; for floating point, the reciprocal of
+ * the unit is computed once so that the element loop only multiplies.
+ */
+template< typename S, bool = std::is_floating_point<S>::value >
+struct unit_scale
+{
+    S reciprocal;
+
+    explicit unit_scale( S const unit ) : reciprocal( S( 1 ) / unit ) { }
+
+    S operator()( S const x ) const { return x * reciprocal; }
+};
+
+template< typename S >
+struct unit_scale< S, false >
+{
+    S unit;
+
+    explicit unit_scale( S const unit ) : unit( unit ) { }
+
+    S operator()( S const x ) const { return x / unit; }
+};
+
+} // namespace detail
+
+/**
+ * \brief non-owning view of a contiguous sequence of magnitudes of type T.
+ */
+template< typename T >
+class magnitude_span
+{
+public:
+    typedef typename std::remove_const<T>::type value_type;
+
+    typedef std::size_t size_type;
+
+    typedef T * pointer;
+    typedef T & reference;
+    typedef T * iterator;
+
+    constexpr magnitude_span() : m_data( nullptr ), m_size( 0 ) { }
+
+    constexpr magnitude_span( pointer data, size_type size )
+    : m_data( data ), m_size( size ) { }
+
+    constexpr pointer   data()  const { return m_data; }
+    constexpr size_type size()  const { return m_size; }
+    constexpr bool      empty() const { return m_size == 0; }
+
+    constexpr iterator  begin() const { return m_data; }
+    constexpr iterator  end()   const { return m_data + m_size; }
+
+    reference operator[]( size_type const i ) const
+    {
+        assert( i < m_size );
+        return m_data[i];
+    }
+
+private:
+    pointer   m_data;
+    size_type m_size;
+};
+
+/**
+ * \brief non-owning view of a contiguous sequence of quantities of dimension Dims.
+ * Use T const for a read-only view.
+ */
+template< typename Dims, typename T /*= Rep */ >
+class quantity_span
+{
+public:
+    typedef Dims dimension_type;
+
+    typedef typename std::remove_const<T>::type magnitude_type;
+
+    typedef quantity<Dims, magnitude_type> value_type;
+
+    typedef typename std::conditional<
+        std::is_const<T>::value, value_type const, value_type >::type element_type;
+
+    typedef std::size_t size_type;
+
+    typedef element_type * pointer;
+    typedef element_type & reference;
+    typedef element_type * iterator;
+
+    constexpr quantity_span() : m_data( nullptr ), m_size( 0 ) { }
+
+    constexpr quantity_span( pointer data, size_type size )
+    : m_data( data ), m_size( size ) { }
+
+    /**
+     * view of an existing buffer of magnitudes as quantities, without copying;
+     * requires magnitude_tag, like constructing a quantity from a magnitude.
+     */
+    quantity_span( detail::magnitude_tag_t, T * data, size_type size )
+    : m_data( reinterpret_cast<pointer>( data ) ), m_size( size )
+    {
+        static_assert( detail::has_magnitude_layout<Dims, magnitude_type>::value,
+            "quantity must have the layout of its magnitude" );
+    }
+
+    /**
+     * converting constructor, e.g. from mutable to read-only view.
+     */
+    template< typename X, typename = typename std::enable_if<
+        std::is_convertible< typename quantity_span<Dims, X>::pointer, pointer >::value >::type >
+    constexpr quantity_span( quantity_span<Dims, X> const & other )
+    : m_data( other.data() ), m_size( other.size() ) { }
+
+    constexpr pointer   data()  const { return m_data; }
+    constexpr size_type size()  const { return m_size; }
+    constexpr bool      empty() const { return m_size == 0; }
+
+    constexpr iterator  begin() const { return m_data; }
+    constexpr iterator  end()   const { return m_data + m_size; }
+
+    reference operator[]( size_type const i ) const
+    {
+        assert( i < m_size );
+        return m_data[i];
+    }
+
+    /**
+     * view of count elements starting at offset.
+     */
+    quantity_span subspan( size_type const offset, size_type const count ) const
+    {
+        assert( offset + count <= m_size );
+        return quantity_span( m_data + offset, count );
+    }
+
+    /**
+     * view of the elements as plain magnitudes, without copying.
+     */
+    magnitude_span<T> magnitudes() const
+    {
+        static_assert( detail::has_magnitude_layout<Dims, magnitude_type>::value,
+            "quantity must have the layout of its magnitude" );
+
+        return magnitude_span<T>( reinterpret_cast<T *>( m_data ), m_size );
+    }
+
+    /**
+     * assign the elements of a span, array or expression, or a single quantity, to the viewed elements.
+     */
+    template< typename R >
+    quantity_span const & assign( R const & r ) const
+    {
+        return detail::evaluate<detail::assign>( m_data, m_size, detail::make_leaf( r ) ), *this;
+    }
+
+    template< typename R >
+    detail::EnableIfRange<R, quantity_span const &>
+    operator+=( R const & r ) const
+    {
+        return detail::evaluate<detail::plus_assign>( m_data, m_size, detail::make_leaf( r ) ), *this;
+    }
+
+    template< typename R >
+    detail::EnableIfRange<R, quantity_span const &>
+    operator-=( R const & r ) const
+    {
+        return detail::evaluate<detail::minus_assign>( m_data, m_size, detail::make_leaf( r ) ), *this;
+    }
+
+    template< typename Y >
+    detail::EnableIfRangeScalar<quantity_span, Y, quantity_span const &>
+    operator*=( Y const & y ) const
+    {
+        return detail::evaluate<detail::times_assign>( m_data, m_size, detail::make_leaf( y ) ), *this;
+    }
+
+    template< typename Y >
+    detail::EnableIfRangeScalar<quantity_span, Y, quantity_span const &>
+    operator/=( Y const & y ) const
+    {
+        return detail::evaluate<detail::div_assign>( m_data, m_size, detail::make_leaf( y ) ), *this;
+    }
+
+private:
+    pointer   m_data;
+    size_type m_size;
+};
+
+/**
+ * read-only view.
+ */
+template< typename Dims, typename T = Rep >
+using const_quantity_span = quantity_span<Dims, T const>;
+
+/**
+ * \brief owning, aligned, contiguous array of quantities of dimension Dims.
+ */
+template< typename Dims, typename T /*= Rep */ >
+class quantity_array
+{
+public:
+    typedef Dims dimension_type;
+
+    typedef T magnitude_type;
+
+    typedef quantity<Dims, T> value_type;
+
+    typedef std::size_t size_type;
+
+    typedef value_type       * pointer;
+    typedef value_type const * const_pointer;
+    typedef value_type       & reference;
+    typedef value_type const & const_reference;
+    typedef value_type       * iterator;
+    typedef value_type const * const_iterator;
+
+    enum { alignment = PHYS_UNITS_ARRAY_ALIGNMENT };
+
+    quantity_array() : m_data( nullptr ), m_size( 0 ) { }
+
+    /**
+     * array of n zero quantities.
+     */
+    explicit quantity_array( size_type const n )
+    : m_data( allocate( n ) ), m_size( n )
+    {
+        auto out = m_data;
+        detail::for_each_index( m_size, [out]( size_type i ) { new( out + i ) value_type(); } );
+    }
+
+    /**
+     * array of n uninitialized quantities, e.g. to be overwritten next.
+     */
+    quantity_array( size_type const n, no_init_t )
+    : m_data( allocate( n ) ), m_size( n ) { }
+
+    /**
+     * array of n copies of q.
+     */
+    template< typename X >
+    quantity_array( size_type const n, quantity<Dims, X> const & q )
+    : m_data( allocate( n ) ), m_size( n )
+    {
+        auto out = m_data; value_type const v( q );
+        detail::for_each_index( m_size, [out, v]( size_type i ) { new( out + i ) value_type( v ); } );
+    }
+
+    quantity_array( std::initializer_list<value_type> list )
+    : m_data( allocate( list.size() ) ), m_size( list.size() )
+    {
+        construct_from( detail::range_leaf<value_type>{ list.begin(), list.size() } );
+    }
+
+    /**
+     * copy of the quantities in a span or array.
+     */
+    template< typename R, typename = typename std::enable_if<
+        detail::is_quantity_range<R>::value && !detail::is_quantity_expression<R>::value >::type >
+    explicit quantity_array( R const & r )
+    : m_data( allocate( r.size() ) ), m_size( r.size() )
+    {
+        static_assert( std::is_same< typename R::dimension_type, Dims >::value, "array dimensions must match" );
+
+        construct_from( detail::make_leaf( r ) );
+    }
+
+    /**
+     * evaluation of an expression.
+     */
+    template< typename E >
+    quantity_array( quantity_expression<E> const & x )
+    : m_data( allocate( x.size() ) ), m_size( x.size() )
+    {
+        construct_from( x.node() );
+    }
+
+    quantity_array( quantity_array const & other )
+    : m_data( allocate( other.m_size ) ), m_size( other.m_size )
+    {
+        construct_from( detail::make_leaf( other ) );
+    }
+
+    quantity_array( quantity_array && other ) noexcept
+    : m_data( other.m_data ), m_size( other.m_size )
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+
+    ~quantity_array()
+    {
+        detail::aligned_deallocate( m_data );
+    }
+
+    quantity_array & operator=( quantity_array other ) noexcept
+    {
+        swap( other );
+        return *this;
+    }
+
+    /**
+     * evaluate the expression into this array; this array may appear in the expression.
+     */
+    template< typename E >
+    quantity_array & operator=( quantity_expression<E> const & x )
+    {
+        if ( x.size() != m_size )
+        {
+            quantity_array( x ).swap( *this );
+        }
+        else
+        {
+            span().assign( x );
+        }
+        return *this;
+    }
+
+    void swap( quantity_array & other ) noexcept
+    {
+        std::swap( m_data, other.m_data );
+        std::swap( m_size, other.m_size );
+    }
+
+    pointer         data()        { return m_data; }
+    const_pointer   data()  const { return m_data; }
+    size_type       size()  const { return m_size; }
+    bool            empty() const { return m_size == 0; }
+
+    iterator        begin()       { return m_data; }
+    const_iterator  begin() const { return m_data; }
+    iterator        end()         { return m_data + m_size; }
+    const_iterator  end()   const { return m_data + m_size; }
+
+    reference operator[]( size_type const i )
+    {
+        assert( i < m_size );
+        return m_data[i];
+    }
+
+    const_reference operator[]( size_type const i ) const
+    {
+        assert( i < m_size );
+        return m_data[i];
+    }
+
+    /**
+     * mutable and read-only views of the array.
+     */
+    quantity_span<Dims, T> span()
+    {
+        return quantity_span<Dims, T>( m_data, m_size );
+    }
+
+    quantity_span<Dims, T const> span() const
+    {
+        return quantity_span<Dims, T const>( m_data, m_size );
+    }
+
+    operator quantity_span<Dims, T>()             { return span(); }
+    operator quantity_span<Dims, T const>() const { return span(); }
+
+    /**
+     * views of the elements as plain magnitudes.
+     */
+    magnitude_span<T>       magnitudes()       { return span().magnitudes(); }
+    magnitude_span<T const> magnitudes() const { return span().magnitudes(); }
+
+    template< typename R >
+    detail::EnableIfRange<R, quantity_array &>
+    operator+=( R const & r )
+    {
+        return span() += r, *this;
+    }
+
+    template< typename R >
+    detail::EnableIfRange<R, quantity_array &>
+    operator-=( R const & r )
+    {
+        return span() -= r, *this;
+    }
+
+    template< typename Y >
+    detail::EnableIfRangeScalar<quantity_array, Y, quantity_array &>
+    operator*=( Y const & y )
+    {
+        return span() *= y, *this;
+    }
+
+    template< typename Y >
+    detail::EnableIfRangeScalar<quantity_array, Y, quantity_array &>
+    operator/=( Y const & y )
+    {
+        return span() /= y, *this;
+    }
+
+private:
+    static pointer allocate( size_type const n )
+    {
+        if ( n > detail::aligned_max_count( sizeof( value_type ), alignment ) )
+        {
+            throw std::bad_alloc();
+        }
+
+        return n == 0 ? nullptr : static_cast<pointer>(
+            detail::aligned_allocate( n * sizeof( value_type ), alignment ) );
+    }
+
+    template< typename E >
+    void construct_from( E const e )
+    {
+        auto out = m_data;
+        detail::for_each_index( m_size, [out, e]( size_type i ) { new( out + i ) value_type( e[i] ); } );
+    }
+
+private:
+    pointer   m_data;
+    size_type m_size;
+};
+
+/**
+ * \brief lazily evaluated element-wise operation on spans and arrays.
+ * E is the tree of expression nodes; value_type is the type of an element of the result.
+ */
+template< typename E >
+class quantity_expression
+{
+public:
+    typedef typename E::value_type value_type;
+
+    typedef std::size_t size_type;
+
+    explicit quantity_expression( E const & e ) : m_node( e ) { }
+
+    size_type size() const { return m_node.size(); }
+
+    value_type operator[]( size_type const i ) const { return m_node[i]; }
+
+    E const & node() const { return m_node; }
+
+private:
+    E m_node;
+};
+
+/**
+ * view a buffer of magnitudes as quantities of dimension Dims, without copying.
+ */
+template< typename Dims, typename T >
+quantity_span<Dims, T> as_quantities( T * data, std::size_t const size )
+{
+    return quantity_span<Dims, T>( detail::magnitude_tag, data, size );
+}
+
+/**
+ * view the elements of a span or array as plain magnitudes, without copying.
+ */
+template< typename Dims, typename T >
+magnitude_span<T> as_magnitudes( quantity_span<Dims, T> const & s )
+{
+    return s.magnitudes();
+}
+
+template< typename Dims, typename T >
+magnitude_span<T> as_magnitudes( quantity_array<Dims, T> & a )
+{
+    return a.magnitudes();
+}
+
+template< typename Dims, typename T >
+magnitude_span<T const> as_magnitudes( quantity_array<Dims, T> const & a )
+{
+    return a.magnitudes();
+}
+
+/**
+ * convert all elements of in to the given unit and store the resulting
+ * numbers in out, like q.to( unit ) for each element, for example to export
+ * samples in miles or in btu_it. For floating point the elements are
+ * multiplied by the reciprocal of unit, which may differ from to() in the
+ * last bit.
+ */
+template< typename Dims, typename T, typename X, typename U >
+void convert( quantity_span<Dims, T> const & in, quantity<Dims, X> const & unit, magnitude_span<U> const & out )
+{
+    typedef typename std::common_type< typename std::remove_const<T>::type, X >::type scale_type;
+
+    assert( in.size() == out.size() );
+
+    T * const src = in.magnitudes().data();
+    U * const dst = out.data();
+
+    detail::unit_scale<scale_type> const scale( unit.magnitude() );
+
+    detail::for_each_index( in.size(), [src, dst, scale]( std::size_t i ) { dst[i] = U( scale( src[i] ) ); } );
+}
+
+template< typename Dims, typename T, typename X, typename U >
+void convert( quantity_array<Dims, T> const & in, quantity<Dims, X> const & unit, magnitude_span<U> const & out )
+{
+    convert( in.span(), unit, out );
+}
+
+/**
+ * convert all elements of s to the given unit in place; afterwards the
+ * buffer holds numbers in that unit, hence the returned magnitude view.
+ */
+template< typename Dims, typename T, typename X >
+magnitude_span<T> convert( quantity_span<Dims, T> const & s, quantity<Dims, X> const & unit )
+{
+    static_assert( !std::is_const<T>::value, "in-place conversion requires a mutable span" );
+
+    magnitude_span<T> const m = s.magnitudes();
+
+    convert( s, unit, m );
+
+    return m;
+}
+
+template< typename Dims, typename T, typename X >
+magnitude_span<T> convert( quantity_array<Dims, T> & a, quantity<Dims, X> const & unit )
+{
+    return convert( a.span(), unit );
+}
+
+/**
+ * evaluate an expression into a new array.
+ */
+template< typename E >
+detail::ArrayOf< typename E::value_type >
+eval( quantity_expression<E> const & x )
+{
+    return detail::ArrayOf< typename E::value_type >( x );
+}
+
+// Element-wise operators; results are expressions.
+
+/// - range
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::negate, R> >
+operator-( R const & r )
+{
+    return detail::Unary<detail::negate, R>( { detail::make_leaf( r ) } );
+}
+
+/// range + range
+
+template< typename RX, typename RY >
+detail::EnableIfRanges<RX, RY, detail::Binary<detail::plus, RX, RY> >
+operator+( RX const & x, RY const & y )
+{
+    return detail::make_binary<detail::plus>( x, y );
+}
+
+/// range - range
+
+template< typename RX, typename RY >
+detail::EnableIfRanges<RX, RY, detail::Binary<detail::minus, RX, RY> >
+operator-( RX const & x, RY const & y )
+{
+    return detail::make_binary<detail::minus>( x, y );
+}
+
+/// range + quantity
+
+template< typename RX, typename D, typename Y >
+detail::EnableIfRange<RX, detail::Binary<detail::plus, RX, quantity<D, Y> > >
+operator+( RX const & x, quantity<D, Y> const & y )
+{
+    return detail::make_binary<detail::plus>( x, y );
+}
+
+/// quantity + range
+
+template< typename D, typename X, typename RY >
+detail::EnableIfRange<RY, detail::Binary<detail::plus, quantity<D, X>, RY> >
+operator+( quantity<D, X> const & x, RY const & y )
+{
+    return detail::make_binary<detail::plus>( x, y );
+}
+
+/// range - quantity
+
+template< typename RX, typename D, typename Y >
+detail::EnableIfRange<RX, detail::Binary<detail::minus, RX, quantity<D, Y> > >
+operator-( RX const & x, quantity<D, Y> const & y )
+{
+    return detail::make_binary<detail::minus>( x, y );
+}
+
+/// quantity - range
+
+template< typename D, typename X, typename RY >
+detail::EnableIfRange<RY, detail::Binary<detail::minus, quantity<D, X>, RY> >
+operator-( quantity<D, X> const & x, RY const & y )
+{
+    return detail::make_binary<detail::minus>( x, y );
+}
+
+/// range + number, for a dimensionless range
+
+template< typename RX, typename Y >
+detail::EnableIfRangeNumber<RX, Y, detail::Binary<detail::plus, RX, Y> >
+operator+( RX const & x, Y const & y )
+{
+    return detail::make_binary<detail::plus>( x, y );
+}
+
+/// number + range, for a dimensionless range
+
+template< typename X, typename RY >
+detail::EnableIfRangeNumber<RY, X, detail::Binary<detail::plus, X, RY> >
+operator+( X const & x, RY const & y )
+{
+    return detail::make_binary<detail::plus>( x, y );
+}
+
+/// range - number, for a dimensionless range
+
+template< typename RX, typename Y >
+detail::EnableIfRangeNumber<RX, Y, detail::Binary<detail::minus, RX, Y> >
+operator-( RX const & x, Y const & y )
+{
+    return detail::make_binary<detail::minus>( x, y );
+}
+
+/// number - range, for a dimensionless range
+
+template< typename X, typename RY >
+detail::EnableIfRangeNumber<RY, X, detail::Binary<detail::minus, X, RY> >
+operator-( X const & x, RY const & y )
+{
+    return detail::make_binary<detail::minus>( x, y );
+}
+
+/// range * range
+
+template< typename RX, typename RY >
+detail::EnableIfRanges<RX, RY, detail::Binary<detail::multiplies, RX, RY> >
+operator*( RX const & x, RY const & y )
+{
+    return detail::make_binary<detail::multiplies>( x, y );
+}
+
+/// range / range
+
+template< typename RX, typename RY >
+detail::EnableIfRanges<RX, RY, detail::Binary<detail::divides, RX, RY> >
+operator/( RX const & x, RY const & y )
+{
+    return detail::make_binary<detail::divides>( x, y );
+}
+
+/// range * scalar; scalar is a number or a quantity.
+
+template< typename RX, typename Y >
+detail::EnableIfRangeScalar<RX, Y, detail::Binary<detail::multiplies, RX, Y> >
+operator*( RX const & x, Y const & y )
+{
+    return detail::make_binary<detail::multiplies>( x, y );
+}
+
+/// scalar * range
+
+template< typename X, typename RY >
+detail::EnableIfRangeScalar<RY, X, detail::Binary<detail::multiplies, X, RY> >
+operator*( X const & x, RY const & y )
+{
+    return detail::make_binary<detail::multiplies>( x, y );
+}
+
+/// range / scalar
+
+template< typename RX, typename Y >
+detail::EnableIfRangeScalar<RX, Y, detail::Binary<detail::divides, RX, Y> >
+operator/( RX const & x, Y const & y )
+{
+    return detail::make_binary<detail::divides>( x, y );
+}
+
+/// scalar / range
+
+template< typename X, typename RY >
+detail::EnableIfRangeScalar<RY, X, detail::Binary<detail::divides, X, RY> >
+operator/( X const & x, RY const & y )
+{
+    return detail::make_binary<detail::divides>( x, y );
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_ARRAY_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,382 @@
+/**
+ * \file quantity_constexpr.hpp
+ *
+ * \brief   Compile-time roots, exp and log, and compile-time tables of quantities.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * The roots of quantity.hpp use std::sqrt() etc., which are not constexpr.
+ * The functions in namespace cx are, so that they can initialize constexpr
+ * quantities and tables; at run time prefer those of quantity.hpp:
+ *
+ * - cx::sqrt( x )          - square root by Newton iteration.
+ * - cx::cbrt( x )          - cube root by Newton iteration.
+ * - cx::nth_root<N>( x )   - N-th root, also for negative N.
+ * - cx::exp( x ), cx::log( x ) - of dimensionless values, i.e. numbers.
+ *
+ * nth_power(), square() and cube() of quantity.hpp are constexpr already.
+ * Results are within a few ulp of the std:: functions; integral roots are
+ * rounded to the nearest integer.
+ *
+ * make_table<N>( f ) yields std::array{ f(0), f(1), ..., f(N-1) }; with a
+ * constexpr function f, the table is a compile-time constant:
+ *
+ *   constexpr quantity<length_d> diagonal( std::size_t i )
+ *   {
+ *       return cx::sqrt( Rep( i ) ) * 5 * micro * meter;
+ *   }
+ *
+ *   constexpr auto diagonals = make_table<4>( diagonal );
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_CONSTEXPR_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_CONSTEXPR_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/// namespace detail.
+
+namespace detail {
+
+/// namespace cx.
+
+namespace cx {
+
+/**
+ * the computation type of the compile-time functions.
+ */
+typedef long double real;
+
+constexpr real ln2 = 0.693147180559945309417232121458176568L;
+constexpr real e   = 2.718281828459045235360287471352662498L;
+
+constexpr real two_24  = 16777216.0L;
+constexpr real two_32  = 4294967296.0L;
+constexpr real two_128 = two_32 * two_32 * two_32 * two_32;
+constexpr real two_256 = two_128 * two_128;
+constexpr real two_384 = two_256 * two_128;
+
+constexpr bool is_finite( real const x )
+{
+    return x == x && x != std::numeric_limits<real>::infinity() && x != -std::numeric_limits<real>::infinity();
+}
+
+/**
+ * square root of x in [1, 2^32) by Newton iteration, starting above the root.
+ */
+constexpr real sqrt_newton( real const x, real const y, real const prev, int const n )
+{
+    return n == 0 || y == prev ? y : sqrt_newton( x, ( y + x / y ) / 2, y, n - 1 );
+}
+
+/**
+ * square root, scaling x into [1, 2^32) in exact steps of 2^256 and 2^32.
+ */
+constexpr real sqrt_scaled( real const x )
+{
+    return x >= two_256     ? two_128 * sqrt_scaled( x / two_256 )
+         : x <  1 / two_256 ? sqrt_scaled( x * two_256 ) / two_128
+         : x >= two_32 ? 65536.0L * sqrt_scaled( x / two_32 )
+         : x <  1      ? sqrt_scaled( x * two_32 ) / 65536.0L
+         : sqrt_newton( x, ( x + 1 ) / 2, 0, 100 );
+}
+
+constexpr real sqrt( real const x )
+{
+    return x < 0 ? std::numeric_limits<real>::quiet_NaN()
+         : x == 0 || !is_finite( x ) ? x
+         : sqrt_scaled( x );
+}
+
+/**
+ * cube root of x in [1, 2^24) by Newton iteration, starting above the root.
+ */
+constexpr real cbrt_newton( real const x, real const y, real const prev, int const n )
+{
+    return n == 0 || y == prev ? y : cbrt_newton( x, ( 2 * y + x / ( y * y ) ) / 3, y, n - 1 );
+}
+
+/**
+ * cube root, scaling x into [1, 2^24) in exact steps of 2^384 and 2^24.
+ */
+constexpr real cbrt_scaled( real const x )
+{
+    return x >= two_384     ? two_128 * cbrt_scaled( x / two_384 )
+         : x <  1 / two_384 ? cbrt_scaled( x * two_384 ) / two_128
+         : x >= two_24 ? 256.0L * cbrt_scaled( x / two_24 )
+         : x <  1      ? cbrt_scaled( x * two_24 ) / 256.0L
+         : cbrt_newton( x, ( x + 2 ) / 3, 0, 100 );
+}
+
+constexpr real cbrt( real const x )
+{
+    return x < 0 ? -cbrt( -x )
+         : x == 0 || !is_finite( x ) ? x
+         : cbrt_scaled( x );
+}
+
+/**
+ * x^n by repeated squaring.
+ */
+constexpr real power( real const x, unsigned const n )
+{
+    return n == 0 ? 1 : ( n % 2 ? x : 1 ) * power( x * x, n / 2 );
+}
+
+/**
+ * exp( x ) for |x| <= 1/2 by its Taylor series.
+ */
+constexpr real exp_series( real const x, real const term, real const sum, int const k )
+{
+    return sum + term == sum ? sum : exp_series( x, term * x / k, sum + term, k + 1 );
+}
+
+/**
+ * exp( x ) = e^n exp( x - n ), n the integer nearest to x.
+ */
+constexpr real exp_split( real const x, long const n )
+{
+    return ( n < 0 ? 1 / power( e, unsigned( -n ) ) : power( e, unsigned( n ) ) ) * exp_series( x - n, 1, 0, 1 );
+}
+
+constexpr real exp( real const x )
+{
+    return x != x ? x
+         : x >  11357 ? std::numeric_limits<real>::infinity()
+         : x < -11400 ? 0
+         : exp_split( x, long( x < 0 ? x - 0.5L : x + 0.5L ) );
+}
+
+/**
+ * log( m ) for m in [1, 2) = 2 atanh( s ), s = ( m - 1 ) / ( m + 1 ), by its series.
+ */
+constexpr real atanh_series( real const s2, real const power, real const sum, int const k )
+{
+    return sum + power / k == sum ? sum : atanh_series( s2, power * s2, sum + power / k, k + 2 );
+}
+
+constexpr real log_mantissa( real const s )
+{
+    return 2 * atanh_series( s * s, s, 0, 1 );
+}
+
+/**
+ * log( x ) = k log( 2 ) + log( m ), scaling x into [1, 2) in exact steps
+ * of 2^256, 2^32 and 2.
+ */
+constexpr real log_scaled( real const x, int const k )
+{
+    return x >= two_256     ? log_scaled( x / two_256, k + 256 )
+         : x <  1 / two_256 ? log_scaled( x * two_256, k - 256 )
+         : x >= two_32 ? log_scaled( x / two_32, k + 32 )
+         : x <  1 / two_32 ? log_scaled( x * two_32, k - 32 )
+         : x >= 2 ? log_scaled( x / 2, k + 1 )
+         : x <  1 ? log_scaled( x * 2, k - 1 )
+         : k * ln2 + log_mantissa( ( x - 1 ) / ( x + 1 ) );
+}
+
+constexpr real log( real const x )
+{
+    return x < 0 ? std::numeric_limits<real>::quiet_NaN()
+         : x == 0 ? -std::numeric_limits<real>::infinity()
+         : !is_finite( x ) ? x
+         : log_scaled( x, 0 );
+}
+
+/**
+ * one Newton step for y^n = x.
+ */
+constexpr real root_newton( real const x, real const y, int const n )
+{
+    return y - ( power( y, unsigned( n ) ) - x ) / ( n * power( y, unsigned( n - 1 ) ) );
+}
+
+/**
+ * N-th root: square and cube roots, repeated square roots for other even N,
+ * exp( log( x ) / N ) and a Newton step otherwise; the sign is kept for odd N.
+ */
+constexpr real root( real const x, int const n )
+{
+    return n < 0  ? 1 / root( x, -n )
+         : n == 1 ? x
+         : n == 2 ? sqrt( x )
+         : n == 3 ? cbrt( x )
+         : n % 2 == 0 ? root( sqrt( x ), n / 2 )
+         : x < 0  ? -root( -x, n )
+         : x == 0 || !is_finite( x ) ? x
+         : root_newton( x, exp( log( x ) / n ), n );
+}
+
+/**
+ * conversion of a result to the magnitude type; integral types are rounded.
+ */
+template< typename X >
+constexpr typename std::enable_if< std::is_integral<X>::value, X >::type
+to_magnitude( real const x )
+{
+    return X( x < 0 ? x - 0.5L : x + 0.5L );
+}
+
+template< typename X >
+constexpr typename std::enable_if< !std::is_integral<X>::value, X >::type
+to_magnitude( real const x )
+{
+    return X( x );
+}
+
+} // namespace cx
+
+/**
+ * a pack of indices 0, 1, ..., N-1, built in log2(N) steps.
+ */
+template< std::size_t... I >
+struct indices { };
+
+template< typename L, typename R >
+struct concat_indices;
+
+template< std::size_t... I, std::size_t... J >
+struct concat_indices< indices<I...>, indices<J...> >
+{
+    typedef indices< I..., ( sizeof...(I) + J )... > type;
+};
+
+template< std::size_t N >
+struct make_indices : concat_indices<
+    typename make_indices< N / 2 >::type, typename make_indices< N - N / 2 >::type > { };
+
+template<>
+struct make_indices< 0 > { typedef indices<> type; };
+
+template<>
+struct make_indices< 1 > { typedef indices<0> type; };
+
+template< typename F >
+using TableElement = typename std::decay< decltype( std::declval<F>()( std::size_t( 0 ) ) ) >::type;
+
+template< std::size_t N, typename F, std::size_t... I >
+constexpr std::array< TableElement<F>, N > make_table( F const & f, indices<I...> )
+{
+    return std::array< TableElement<F>, N >{ { f( I )... } };
+}
+
+} // namespace detail
+
+/// namespace cx, compile-time roots, exp and log.
+
+namespace cx {
+
+/// sqrt( quantity ).
+
+template< typename D, typename X >
+constexpr detail::Root<D, 2, X> sqrt( quantity<D, X> const & x )
+{
+    static_assert( detail::root<D, 2, X>::all_even_multiples, "root result dimensions must be integral" );
+
+    return detail::from_magnitude< detail::Root<D, 2, X> >::make(
+        detail::cx::to_magnitude<X>( detail::cx::sqrt( x.magnitude() ) ) );
+}
+
+/// sqrt( number ).
+
+template< typename X >
+constexpr detail::EnableIfNumber<X, X> sqrt( X const x )
+{
+    return detail::cx::to_magnitude<X>( detail::cx::sqrt( x ) );
+}
+
+/// cbrt( quantity ).
+
+template< typename D, typename X >
+constexpr detail::Root<D, 3, X> cbrt( quantity<D, X> const & x )
+{
+    static_assert( detail::root<D, 3, X>::all_even_multiples, "root result dimensions must be integral" );
+
+    return detail::from_magnitude< detail::Root<D, 3, X> >::make(
+        detail::cx::to_magnitude<X>( detail::cx::cbrt( x.magnitude() ) ) );
+}
+
+/// cbrt( number ).
+
+template< typename X >
+constexpr detail::EnableIfNumber<X, X> cbrt( X const x )
+{
+    return detail::cx::to_magnitude<X>( detail::cx::cbrt( x ) );
+}
+
+/// nth_root( quantity ).
+
+template< int N, typename D, typename X >
+constexpr detail::Root<D, N, X> nth_root( quantity<D, X> const & x )
+{
+    static_assert( detail::root<D, N, X>::all_even_multiples, "root result dimensions must be integral" );
+
+    return detail::from_magnitude< detail::Root<D, N, X> >::make(
+        detail::cx::to_magnitude<X>( detail::cx::root( x.magnitude(), N ) ) );
+}
+
+/// nth_root( number ).
+
+template< int N, typename X >
+constexpr detail::EnableIfNumber<X, X> nth_root( X const x )
+{
+    return detail::cx::to_magnitude<X>( detail::cx::root( x, N ) );
+}
+
+/// exp( number ); quantities to exponentiate must be dimensionless, i.e. numbers.
+
+template< typename X >
+constexpr typename std::enable_if< std::is_floating_point<X>::value, X >::type
+exp( X const x )
+{
+    return X( detail::cx::exp( x ) );
+}
+
+/// log( number ).
+
+template< typename X >
+constexpr typename std::enable_if< std::is_floating_point<X>::value, X >::type
+log( X const x )
+{
+    return X( detail::cx::log( x ) );
+}
+
+} // namespace cx
+
+/// std::array{ f(0), f(1), ..., f(N-1) }; a compile-time constant for a constexpr f.
+
+template< std::size_t N, typename F >
+constexpr std::array< detail::TableElement<F>, N > make_table( F const & f )
+{
+    return detail::make_table<N>( f, typename detail::make_indices<N>::type() );
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_CONSTEXPR_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,213 @@
+/**
+ * \file quantity_fwd.hpp
+ *
+ * \brief   Forward declarations of the quantity library.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * The magnitude types, quantity, dimensions and the named dimensions,
+ * without a single standard header: enough to declare functions that take
+ * or return quantities, and to specialize unit_info. quantity.hpp includes
+ * this file, which holds the default template arguments.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_FWD_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_FWD_HPP_INCLUDED
+
+#include "phys/units/quantity_macros.hpp"
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+#ifdef PHYS_UNITS_REP_TYPE
+   using Rep = PHYS_UNITS_REP_TYPE;
+#else
+   using Rep = double;
+#endif
+
+/*
+ * magnitude type of the quantities that the user-defined literals yield.
+ */
+#ifdef PHYS_UNITS_LITERAL_TYPE
+   using LiteralRep = PHYS_UNITS_LITERAL_TYPE;
+#else
+   using LiteralRep = Rep;
+#endif
+
+/*
+ * declare now, define later; with PHYS_UNITS_ERASED, a quantity is its
+ * magnitude (see quantity_macros.hpp).
+ */
+#ifdef PHYS_UNITS_ERASED
+template< typename Dims, typename T = Rep >
+using quantity = T;
+#else
+template< typename Dims, typename T = Rep >
+class quantity;
+#endif
+
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+
+/// namespace detail.
+
+namespace detail {
+
+/*
+ * Packed dimensions: the seven exponents as balanced digits of one number,
+ * code = D1 + 256 * ( D2 + 256 * ( D3 + ... ) ), for exponents in [-128, 127].
+ * As the code is linear in the exponents, the code of a product is the sum
+ * of the codes, that of an N-th power N times the code, etc.
+ */
+typedef long long dimension_code;
+
+PHYS_UNITS_CONSTANT dimension_code dimension_radix = 256;
+
+constexpr dimension_code encode_dimensions( int D1, int D2, int D3, int D4, int D5, int D6, int D7 )
+{
+    return D1 + dimension_radix * ( D2 + dimension_radix * ( D3 + dimension_radix * (
+           D4 + dimension_radix * ( D5 + dimension_radix * ( D6 + dimension_radix * dimension_code( D7 ) ) ) ) ) );
+}
+
+constexpr bool dimension_fits( int const D )
+{
+    return D >= -dimension_radix / 2 && D < dimension_radix / 2;
+}
+
+/*
+ * code of dimensions<D1, ..., D7>; an exponent outside [-128, 127] would
+ * silently carry into the next one, e.g. m+200 into kg m-56.
+ */
+template< int D1, int D2, int D3, int D4, int D5, int D6, int D7 >
+struct dimensions_code
+{
+    static_assert( dimension_fits( D1 ) && dimension_fits( D2 ) && dimension_fits( D3 ) && dimension_fits( D4 ) &&
+                   dimension_fits( D5 ) && dimension_fits( D6 ) && dimension_fits( D7 ),
+                   "packed dimension exponents must be in [-128, 127]" );
+
+    static constexpr dimension_code value = encode_dimensions( D1, D2, D3, D4, D5, D6, D7 );
+};
+
+} // namespace detail
+
+template< detail::dimension_code Code >
+struct packed_dimensions;
+
+template< int D1, int D2, int D3, int D4 = 0, int D5 = 0, int D6 = 0, int D7 = 0 >
+using dimensions = packed_dimensions< detail::dimensions_code< D1, D2, D3, D4, D5, D6, D7 >::value >;
+
+#else // PHYS_UNITS_PACKED_DIMENSIONS
+
+template< int D1, int D2, int D3, int D4 = 0, int D5 = 0, int D6 = 0, int D7 = 0 >
+struct dimensions;
+
+#endif // PHYS_UNITS_PACKED_DIMENSIONS
+
+/// demensionless 'dimension'.
+
+typedef dimensions< 0, 0, 0 > dimensionless_d;
+
+// Give names to the seven fundamental dimensions of physical reality.
+
+typedef dimensions< 1, 0, 0, 0, 0, 0, 0 > length_d;
+typedef dimensions< 0, 1, 0, 0, 0, 0, 0 > mass_d;
+typedef dimensions< 0, 0, 1, 0, 0, 0, 0 > time_interval_d;
+typedef dimensions< 0, 0, 0, 1, 0, 0, 0 > electric_current_d;
+typedef dimensions< 0, 0, 0, 0, 1, 0, 0 > thermodynamic_temperature_d;
+typedef dimensions< 0, 0, 0, 0, 0, 1, 0 > amount_of_substance_d;
+typedef dimensions< 0, 0, 0, 0, 0, 0, 1 > luminous_intensity_d;
+
+// The rest of the standard dimensional types, as specified in SP811.
+
+using absorbed_dose_d             = dimensions< 2, 0, -2 >;
+using absorbed_dose_rate_d        = dimensions< 2, 0, -3 >;
+using acceleration_d              = dimensions< 1, 0, -2 >;
+using activity_of_a_nuclide_d     = dimensions< 0, 0, -1 >;
+using angular_velocity_d          = dimensions< 0, 0, -1 >;
+using angular_acceleration_d      = dimensions< 0, 0, -2 >;
+using area_d                      = dimensions< 2, 0, 0 >;
+using capacitance_d               = dimensions< -2, -1, 4, 2 >;
+using concentration_d             = dimensions< -3, 0, 0, 0, 0, 1 >;
+using current_density_d           = dimensions< -2, 0, 0, 1 >;
+using dose_equivalent_d           = dimensions< 2, 0, -2 >;
+using dynamic_viscosity_d         = dimensions< -1, 1, -1 >;
+using electric_charge_d           = dimensions< 0, 0, 1, 1 >;
+using electric_charge_density_d   = dimensions< -3, 0, 1, 1 >;
+using electric_conductance_d      = dimensions< -2, -1, 3, 2 >;
+using electric_field_strenth_d    = dimensions< 1, 1, -3, -1 >;
+using electric_flux_density_d     = dimensions< -2, 0, 1, 1 >;
+using electric_potential_d        = dimensions< 2, 1, -3, -1 >;
+using electric_resistance_d       = dimensions< 2, 1, -3, -2 >;
+using energy_d                    = dimensions< 2, 1, -2 >;
+using energy_density_d            = dimensions< -1, 1, -2 >;
+using exposure_d                  = dimensions< 0, -1, 1, 1 >;
+using force_d                     = dimensions< 1, 1, -2 >;
+using frequency_d                 = dimensions< 0, 0, -1 >;
+using heat_capacity_d             = dimensions< 2, 1, -2, 0, -1 >;
+using heat_density_d              = dimensions< 0, 1, -2 >;
+using heat_density_flow_rate_d    = dimensions< 0, 1, -3 >;
+using heat_flow_rate_d            = dimensions< 2, 1, -3 >;
+using heat_flux_density_d         = dimensions< 0, 1, -3 >;
+using heat_transfer_coefficient_d = dimensions< 0, 1, -3, 0, -1 >;
+using illuminance_d               = dimensions< -2, 0, 0, 0, 0, 0, 1 >;
+using inductance_d                = dimensions< 2, 1, -2, -2 >;
+using irradiance_d                = dimensions< 0, 1, -3 >;
+using kinematic_viscosity_d       = dimensions< 2, 0, -1 >;
+using luminance_d                 = dimensions< -2, 0, 0, 0, 0, 0, 1 >;
+using luminous_flux_d             = dimensions< 0, 0, 0, 0, 0, 0, 1 >;
+using magnetic_field_strength_d   = dimensions< -1, 0, 0, 1 >;
+using magnetic_flux_d             = dimensions< 2, 1, -2, -1 >;
+using magnetic_flux_density_d     = dimensions< 0, 1, -2, -1 >;
+using magnetic_permeability_d     = dimensions< 1, 1, -2, -2 >;
+using mass_density_d              = dimensions< -3, 1, 0 >;
+using mass_flow_rate_d            = dimensions< 0, 1, -1 >;
+using molar_energy_d              = dimensions< 2, 1, -2, 0, 0, -1 >;
+using molar_entropy_d             = dimensions< 2, 1, -2, -1, 0, -1 >;
+using moment_of_force_d           = dimensions< 2, 1, -2 >;
+using permittivity_d              = dimensions< -3, -1, 4, 2 >;
+using power_d                     = dimensions< 2, 1, -3 >;
+using pressure_d                  = dimensions< -1, 1, -2 >;
+using radiance_d                  = dimensions< 0, 1, -3 >;
+using radiant_intensity_d         = dimensions< 2, 1, -3 >;
+using speed_d                     = dimensions< 1, 0, -1 >;
+using specific_energy_d           = dimensions< 2, 0, -2 >;
+using specific_heat_capacity_d    = dimensions< 2, 0, -2, 0, -1 >;
+using specific_volume_d           = dimensions< 3, -1, 0 >;
+using substance_permeability_d    = dimensions< -1, 0, 1 >;
+using surface_tension_d           = dimensions< 0, 1, -2 >;
+using thermal_conductivity_d      = dimensions< 1, 1, -3, 0, -1 >;
+using thermal_diffusivity_d       = dimensions< 2, 0, -1 >;
+using thermal_insulance_d         = dimensions< 0, -1, 3, 0, 1 >;
+using thermal_resistance_d        = dimensions< -2, -1, 3, 0, 1 >;
+using thermal_resistivity_d       = dimensions< -1, -1, 3, 0, 1 >;
+using torque_d                    = dimensions< 2, 1, -2 >;
+using volume_d                    = dimensions< 3, 0, 0 >;
+using volume_flow_rate_d          = dimensions< 3, 0, -1 >;
+using wave_number_d               = dimensions< -1, 0, 0 >;
+
+/**
+ * unit name and symbol of a dimension, see quantity_io.hpp.
+ */
+template< typename Dims >
+struct unit_info;
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_FWD_HPP_INCLUDED
+
+/*
+ * end of file
+ */
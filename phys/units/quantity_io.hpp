@@ -24,12 +24,40 @@
 
 #include "phys/units/quantity.hpp"
 
-#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iosfwd>
-#include <map>
+#include <limits>
 #include <stdexcept>
 #include <string>
-#include <sstream>
+#include <system_error>
+#include <type_traits>
+
+#if defined( __has_include ) && __cplusplus >= 201703L
+# if __has_include( <charconv> )
+#  include <charconv>
+# endif
+#endif
+
+/*
+ * This file formats with std::to_chars() where the standard library has it
+ * for floating point types (C++17), otherwise with snprintf(), replacing the
+ * decimal point of the C locale (LC_NUMERIC) by '.'; the text is the same in
+ * any locale. It declares the stream operators with
+ * <iosfwd> only; <ostream> is needed where a quantity is streamed, which is
+ * where the stream comes from anyway.
+ */
+
+/*
+ * Note: micro, , may not work everywhere, so you can define a glyph yourself;
+ * prefix() accepts both "u" and the glyph.
+ */
+#ifndef ENG_FORMAT_MICRO_GLYPH
+# define ENG_FORMAT_MICRO_GLYPH "u"
+#endif
 
 /// namespace phys.
 
@@ -39,6 +67,699 @@ namespace phys {
 
 namespace units {
 
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * replace the decimal point of the C locale, e.g. ',' in de_DE, by '.' in the
+ * number that printf() formatted into buf, null-terminated; returns the new
+ * length, or length as is if the number did not fit. The decimal point is
+ * what follows the leading digits up to the next digit; "%g" leaves it out
+ * for integral values, and inf and nan have no digits.
+ */
+inline int c_decimal_point( char * const buf, std::size_t const size, int const length )
+{
+    if ( length < 0 || std::size_t( length ) >= size )
+        return length;
+
+    int i = 0;
+
+    while ( i < length && ( '-' == buf[i] || '+' == buf[i] || ' ' == buf[i] ) )
+        ++i;
+
+    int const integral = i;
+
+    while ( i < length && '0' <= buf[i] && buf[i] <= '9' )
+        ++i;
+
+    if ( i == integral || i == length || '.' == buf[i] || 'e' == buf[i] || 'E' == buf[i] )
+        return length;
+
+    int end = i + 1;
+
+    while ( end < length && !( '0' <= buf[end] && buf[end] <= '9' ) )
+        ++end;
+
+    buf[i] = '.';
+    std::memmove( buf + i + 1, buf + end, length - end + 1 );
+
+    return length - ( end - i - 1 );
+}
+
+/// printf-style formatting of a number to a string, with '.' as decimal point.
+
+template< typename... Args >
+std::string format( char const * const fmt, Args const... args )
+{
+    int const length = std::snprintf( nullptr, 0, fmt, args... );
+
+    if ( length <= 0 )
+        return std::string();
+
+    std::string result( length + 1, '\0' );
+    std::snprintf( &result[0], result.size(), fmt, args... );
+    result.resize( c_decimal_point( &result[0], result.size(), length ) );
+
+    return result;
+}
+
+/// magnitude as string, as a std::ostream with default formatting gives it.
+
+PHYS_UNITS_IO_API std::string to_magnitude_string( long double const value );
+
+PHYS_UNITS_IO_API std::string to_magnitude_string( double const value );
+
+template< typename T >
+typename std::enable_if< std::is_integral<T>::value, std::string >::type
+to_magnitude_string( T const & value )
+{
+    return std::to_string( value );
+}
+
+/**
+ * stream buffer that appends to a string, to stream a magnitude of class
+ * type without <sstream>. As with operator<<, <ostream> is only needed where
+ * such a magnitude is formatted: Char keeps the stream types dependent.
+ */
+
+template< typename Char >
+class string_appender : public std::basic_streambuf<Char>
+{
+public:
+    typedef std::char_traits<Char> traits_type;
+    typedef typename traits_type::int_type int_type;
+
+    explicit string_appender( std::basic_string<Char> & text )
+    : text( text ) {}
+
+protected:
+    int_type overflow( int_type const ch )
+    {
+        if ( !traits_type::eq_int_type( ch, traits_type::eof() ) )
+            text.push_back( traits_type::to_char_type( ch ) );
+
+        return traits_type::not_eof( ch );
+    }
+
+    std::streamsize xsputn( Char const * const s, std::streamsize const n )
+    {
+        text.append( s, static_cast<std::size_t>( n ) );
+        return n;
+    }
+
+private:
+    std::basic_string<Char> & text;
+};
+
+template< typename T, typename Char = char >
+typename std::enable_if< !std::is_arithmetic<T>::value, std::basic_string<Char> >::type
+to_magnitude_string( T const & value )
+{
+    std::basic_string<Char> text;
+    string_appender<Char> buf( text );
+    std::basic_ostream<Char> os( &buf );
+
+    os << value;
+
+    return text;
+}
+
+/// printf-style %g conversion and its inverse per floating point type.
+
+inline int print_float( char * const buf, std::size_t const size, int const precision, double const value )
+{
+    return std::snprintf( buf, size, "%.*g", precision, value );
+}
+
+inline int print_float( char * const buf, std::size_t const size, int const precision, long double const value )
+{
+    return std::snprintf( buf, size, "%.*Lg", precision, value );
+}
+
+inline float       read_float( char const * const buf, float       ) { return std::strtof ( buf, nullptr ); }
+inline double      read_float( char const * const buf, double      ) { return std::strtod ( buf, nullptr ); }
+inline long double read_float( char const * const buf, long double ) { return std::strtold( buf, nullptr ); }
+
+/*
+ * Shortest digits of a double or a float with Grisu3, after Florian Loitsch,
+ * "Printing Floating-Point Numbers Quickly and Accurately with Integers",
+ * PLDI 2010, and its implementation in the double-conversion library.
+ * Grisu3 computes with 64-bit integers only. For about 0.5% of the doubles
+ * it cannot prove its digits shortest and reports failure; print_magnitude()
+ * then falls back to std::to_chars(), or to snprintf() and strtod().
+ */
+
+/// floating point number f * 2^e with a 64-bit significand.
+
+struct diy_fp
+{
+    std::uint64_t f;
+    int e;
+};
+
+/// product, rounded to 64 bits.
+
+inline diy_fp multiply( diy_fp const x, diy_fp const y )
+{
+    std::uint64_t const m32 = 0xFFFFFFFFu;
+
+    std::uint64_t const a = x.f >> 32, b = x.f & m32;
+    std::uint64_t const c = y.f >> 32, d = y.f & m32;
+
+    std::uint64_t const ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    std::uint64_t const mid = ( bd >> 32 ) + ( ad & m32 ) + ( bc & m32 ) + ( std::uint64_t( 1 ) << 31 );
+
+    return { ac + ( ad >> 32 ) + ( bc >> 32 ) + ( mid >> 32 ), x.e + y.e + 64 };
+}
+
+/// shift the significand up until its top bit is set.
+
+inline diy_fp normalize( diy_fp x )
+{
+    while ( !( x.f & 0xFFC0000000000000ULL ) )
+    {
+        x.f <<= 10;
+        x.e  -= 10;
+    }
+    while ( !( x.f & 0x8000000000000000ULL ) )
+    {
+        x.f <<= 1;
+        x.e  -= 1;
+    }
+    return x;
+}
+
+/**
+ * normalized 10^k for k = -348 + 8 * index, as f, e and k; a switch rather
+ * than a static table, which GCC 12 does not link from the phys.units module.
+ */
+
+struct cached_power_entry
+{
+    std::uint64_t f;
+    short e;
+    short k;
+};
+
+inline cached_power_entry cached_power_at( int const index )
+{
+    switch ( index )
+    {
+    case  0: return { 0xFA8FD5A0081C0288ULL, -1220, -348 };
+    case  1: return { 0xBAAEE17FA23EBF76ULL, -1193, -340 };
+    case  2: return { 0x8B16FB203055AC76ULL, -1166, -332 };
+    case  3: return { 0xCF42894A5DCE35EAULL, -1140, -324 };
+    case  4: return { 0x9A6BB0AA55653B2DULL, -1113, -316 };
+    case  5: return { 0xE61ACF033D1A45DFULL, -1087, -308 };
+    case  6: return { 0xAB70FE17C79AC6CAULL, -1060, -300 };
+    case  7: return { 0xFF77B1FCBEBCDC4FULL, -1034, -292 };
+    case  8: return { 0xBE5691EF416BD60CULL, -1007, -284 };
+    case  9: return { 0x8DD01FAD907FFC3CULL,  -980, -276 };
+    case 10: return { 0xD3515C2831559A83ULL,  -954, -268 };
+    case 11: return { 0x9D71AC8FADA6C9B5ULL,  -927, -260 };
+    case 12: return { 0xEA9C227723EE8BCBULL,  -901, -252 };
+    case 13: return { 0xAECC49914078536DULL,  -874, -244 };
+    case 14: return { 0x823C12795DB6CE57ULL,  -847, -236 };
+    case 15: return { 0xC21094364DFB5637ULL,  -821, -228 };
+    case 16: return { 0x9096EA6F3848984FULL,  -794, -220 };
+    case 17: return { 0xD77485CB25823AC7ULL,  -768, -212 };
+    case 18: return { 0xA086CFCD97BF97F4ULL,  -741, -204 };
+    case 19: return { 0xEF340A98172AACE5ULL,  -715, -196 };
+    case 20: return { 0xB23867FB2A35B28EULL,  -688, -188 };
+    case 21: return { 0x84C8D4DFD2C63F3BULL,  -661, -180 };
+    case 22: return { 0xC5DD44271AD3CDBAULL,  -635, -172 };
+    case 23: return { 0x936B9FCEBB25C996ULL,  -608, -164 };
+    case 24: return { 0xDBAC6C247D62A584ULL,  -582, -156 };
+    case 25: return { 0xA3AB66580D5FDAF6ULL,  -555, -148 };
+    case 26: return { 0xF3E2F893DEC3F126ULL,  -529, -140 };
+    case 27: return { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 };
+    case 28: return { 0x87625F056C7C4A8BULL,  -475, -124 };
+    case 29: return { 0xC9BCFF6034C13053ULL,  -449, -116 };
+    case 30: return { 0x964E858C91BA2655ULL,  -422, -108 };
+    case 31: return { 0xDFF9772470297EBDULL,  -396, -100 };
+    case 32: return { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 };
+    case 33: return { 0xF8A95FCF88747D94ULL,  -343,  -84 };
+    case 34: return { 0xB94470938FA89BCFULL,  -316,  -76 };
+    case 35: return { 0x8A08F0F8BF0F156BULL,  -289,  -68 };
+    case 36: return { 0xCDB02555653131B6ULL,  -263,  -60 };
+    case 37: return { 0x993FE2C6D07B7FACULL,  -236,  -52 };
+    case 38: return { 0xE45C10C42A2B3B06ULL,  -210,  -44 };
+    case 39: return { 0xAA242499697392D3ULL,  -183,  -36 };
+    case 40: return { 0xFD87B5F28300CA0EULL,  -157,  -28 };
+    case 41: return { 0xBCE5086492111AEBULL,  -130,  -20 };
+    case 42: return { 0x8CBCCC096F5088CCULL,  -103,  -12 };
+    case 43: return { 0xD1B71758E219652CULL,   -77,   -4 };
+    case 44: return { 0x9C40000000000000ULL,   -50,    4 };
+    case 45: return { 0xE8D4A51000000000ULL,   -24,   12 };
+    case 46: return { 0xAD78EBC5AC620000ULL,     3,   20 };
+    case 47: return { 0x813F3978F8940984ULL,    30,   28 };
+    case 48: return { 0xC097CE7BC90715B3ULL,    56,   36 };
+    case 49: return { 0x8F7E32CE7BEA5C70ULL,    83,   44 };
+    case 50: return { 0xD5D238A4ABE98068ULL,   109,   52 };
+    case 51: return { 0x9F4F2726179A2245ULL,   136,   60 };
+    case 52: return { 0xED63A231D4C4FB27ULL,   162,   68 };
+    case 53: return { 0xB0DE65388CC8ADA8ULL,   189,   76 };
+    case 54: return { 0x83C7088E1AAB65DBULL,   216,   84 };
+    case 55: return { 0xC45D1DF942711D9AULL,   242,   92 };
+    case 56: return { 0x924D692CA61BE758ULL,   269,  100 };
+    case 57: return { 0xDA01EE641A708DEAULL,   295,  108 };
+    case 58: return { 0xA26DA3999AEF774AULL,   322,  116 };
+    case 59: return { 0xF209787BB47D6B85ULL,   348,  124 };
+    case 60: return { 0xB454E4A179DD1877ULL,   375,  132 };
+    case 61: return { 0x865B86925B9BC5C2ULL,   402,  140 };
+    case 62: return { 0xC83553C5C8965D3DULL,   428,  148 };
+    case 63: return { 0x952AB45CFA97A0B3ULL,   455,  156 };
+    case 64: return { 0xDE469FBD99A05FE3ULL,   481,  164 };
+    case 65: return { 0xA59BC234DB398C25ULL,   508,  172 };
+    case 66: return { 0xF6C69A72A3989F5CULL,   534,  180 };
+    case 67: return { 0xB7DCBF5354E9BECEULL,   561,  188 };
+    case 68: return { 0x88FCF317F22241E2ULL,   588,  196 };
+    case 69: return { 0xCC20CE9BD35C78A5ULL,   614,  204 };
+    case 70: return { 0x98165AF37B2153DFULL,   641,  212 };
+    case 71: return { 0xE2A0B5DC971F303AULL,   667,  220 };
+    case 72: return { 0xA8D9D1535CE3B396ULL,   694,  228 };
+    case 73: return { 0xFB9B7CD9A4A7443CULL,   720,  236 };
+    case 74: return { 0xBB764C4CA7A44410ULL,   747,  244 };
+    case 75: return { 0x8BAB8EEFB6409C1AULL,   774,  252 };
+    case 76: return { 0xD01FEF10A657842CULL,   800,  260 };
+    case 77: return { 0x9B10A4E5E9913129ULL,   827,  268 };
+    case 78: return { 0xE7109BFBA19C0C9DULL,   853,  276 };
+    case 79: return { 0xAC2820D9623BF429ULL,   880,  284 };
+    case 80: return { 0x80444B5E7AA7CF85ULL,   907,  292 };
+    case 81: return { 0xBF21E44003ACDD2DULL,   933,  300 };
+    case 82: return { 0x8E679C2F5E44FF8FULL,   960,  308 };
+    case 83: return { 0xD433179D9C8CB841ULL,   986,  316 };
+    case 84: return { 0x9E19DB92B4E31BA9ULL,  1013,  324 };
+    case 85: return { 0xEB96BF6EBADF77D9ULL,  1039,  332 };
+    default: return { 0xAF87023B9BF0EE6BULL,  1066,  340 };
+    }
+}
+
+/**
+ * cached power 10^k that scales a normalized number with exponent e to
+ * an exponent in [-60, -32], so that its integral part fits 32 bits.
+ */
+inline diy_fp cached_power( int const e, int & k )
+{
+    double const estimate = ( -60 - ( e + 64 ) + 63 ) * 0.30102999566398114; // log10(2)
+
+    int ceiling = int( estimate );
+
+    if ( ceiling < estimate )
+        ++ceiling;
+
+    cached_power_entry const cached = cached_power_at( ( 348 + ceiling - 1 ) / 8 + 1 );
+
+    k = cached.k;
+    return { cached.f, cached.e };
+}
+
+/**
+ * move the last digit towards w while that stays within the safe interval;
+ * false if the digits cannot be proven closest.
+ */
+inline bool round_weed( char * const digits, int const length, std::uint64_t const distance_too_high_w,
+    std::uint64_t const unsafe_interval, std::uint64_t rest, std::uint64_t const ten_kappa, std::uint64_t const unit )
+{
+    std::uint64_t const small_distance = distance_too_high_w - unit;
+    std::uint64_t const big_distance   = distance_too_high_w + unit;
+
+    while ( rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+        ( rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance ) )
+    {
+        --digits[ length - 1 ];
+        rest += ten_kappa;
+    }
+
+    if ( rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+        ( rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance ) )
+    {
+        return false;
+    }
+
+    return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+/**
+ * shortest digits of w within the scaled boundaries (low, high), with w * 10^kappa
+ * the value of the digits; returns their number, or 0 on failure.
+ */
+inline int digit_gen( diy_fp const low, diy_fp const w, diy_fp const high, char * const digits, int & kappa )
+{
+    std::uint64_t unit = 1;
+    std::uint64_t const too_low  = low.f  - unit;
+    std::uint64_t const too_high = high.f + unit;
+    std::uint64_t unsafe_interval = too_high - too_low;
+
+    int const shift = -w.e;
+    std::uint64_t const one = std::uint64_t( 1 ) << shift;
+
+    std::uint32_t integrals = std::uint32_t( too_high >> shift );
+    std::uint64_t fractionals = too_high & ( one - 1 );
+
+    std::uint32_t divisor = 1;
+
+    for ( kappa = 1; integrals / divisor >= 10; ++kappa )
+    {
+        divisor *= 10;
+    }
+
+    int length = 0;
+
+    while ( kappa > 0 )
+    {
+        digits[ length++ ] = char( '0' + integrals / divisor );
+        integrals %= divisor;
+        --kappa;
+
+        std::uint64_t const rest = ( std::uint64_t( integrals ) << shift ) + fractionals;
+
+        if ( rest < unsafe_interval )
+        {
+            return round_weed( digits, length, too_high - w.f, unsafe_interval, rest, std::uint64_t( divisor ) << shift, unit ) ? length : 0;
+        }
+        divisor /= 10;
+    }
+
+    for ( ;; )
+    {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+
+        digits[ length++ ] = char( '0' + ( fractionals >> shift ) );
+        fractionals &= one - 1;
+        --kappa;
+
+        if ( fractionals < unsafe_interval )
+        {
+            return round_weed( digits, length, ( too_high - w.f ) * unit, unsafe_interval, fractionals, one, unit ) ? length : 0;
+        }
+    }
+}
+
+/**
+ * shortest digits of f * 2^e, f > 0, of a type whose lower neighbour is
+ * closer if lower_closer; the value is digits * 10^exponent. Returns the
+ * number of digits, or 0 on failure.
+ */
+inline int grisu3( std::uint64_t const f, int const e, bool const lower_closer, char * const digits, int & exponent )
+{
+    diy_fp const w    = normalize( { f, e } );
+    diy_fp const plus = normalize( { ( f << 1 ) + 1, e - 1 } );
+    diy_fp minus      = lower_closer ? diy_fp{ ( f << 2 ) - 1, e - 2 } : diy_fp{ ( f << 1 ) - 1, e - 1 };
+
+    minus.f <<= minus.e - plus.e;
+    minus.e   = plus.e;
+
+    int k = 0;
+    diy_fp const c = cached_power( w.e, k );
+
+    int kappa = 0;
+    int const length = digit_gen( multiply( minus, c ), multiply( w, c ), multiply( plus, c ), digits, kappa );
+
+    exponent = kappa - k;
+    return length;
+}
+
+/**
+ * length characters of text into buf, truncated and null-terminated as
+ * snprintf() does; returns length.
+ */
+inline int format_digits_text( char * const buf, std::size_t const size, char const * const text, int const length )
+{
+    if ( size > 0 )
+    {
+        std::size_t const copied = std::size_t( length ) < size ? std::size_t( length ) : size - 1;
+        std::memcpy( buf, text, copied );
+        buf[ copied ] = '\0';
+    }
+    return length;
+}
+
+/**
+ * digits * 10^exponent into buf as "%.*g" formats it with precision
+ * max( length, min_precision ); returns the number of characters.
+ */
+inline int format_digits( char * const buf, std::size_t const size, bool const negative,
+    char const * const digits, int length, int exponent, int const min_precision )
+{
+    while ( length > 1 && '0' == digits[ length - 1 ] )
+    {
+        --length;
+        ++exponent;
+    }
+
+    char text[ 40 ];
+    char * p = text;
+
+    if ( negative )
+        *p++ = '-';
+
+    int const x = exponent + length - 1;
+    int const precision = length > min_precision ? length : min_precision;
+
+    if ( x < -4 || x >= precision )
+    {
+        *p++ = digits[0];
+
+        if ( length > 1 )
+        {
+            *p++ = '.';
+            std::memcpy( p, digits + 1, length - 1 );
+            p += length - 1;
+        }
+
+        int const a = x < 0 ? -x : x;
+
+        *p++ = 'e';
+        *p++ = x < 0 ? '-' : '+';
+
+        if ( a >= 1000 )
+            *p++ = char( '0' + a / 1000 );
+
+        if ( a >= 100 )
+            *p++ = char( '0' + a / 100 % 10 );
+
+        *p++ = char( '0' + a / 10 % 10 );
+        *p++ = char( '0' + a % 10 );
+    }
+    else if ( x < 0 )
+    {
+        *p++ = '0';
+        *p++ = '.';
+
+        for ( int i = x + 1; i < 0; ++i )
+            *p++ = '0';
+
+        std::memcpy( p, digits, length );
+        p += length;
+    }
+    else if ( length <= x + 1 )
+    {
+        std::memcpy( p, digits, length );
+        p += length;
+
+        for ( int i = length; i <= x; ++i )
+            *p++ = '0';
+    }
+    else
+    {
+        std::memcpy( p, digits, x + 1 );
+        p += x + 1;
+        *p++ = '.';
+        std::memcpy( p, digits + x + 1, length - x - 1 );
+        p += length - x - 1;
+    }
+
+    return format_digits_text( buf, size, text, int( p - text ) );
+}
+
+/**
+ * shortest representation of a finite, non-zero double or float into buf,
+ * as print_magnitude() gives it; returns the length, or 0 if Grisu3 fails
+ * or for zero, infinity and NaN.
+ */
+inline int print_shortest( char * const buf, std::size_t const size, double const value )
+{
+    std::uint64_t bits = 0;
+    std::memcpy( &bits, &value, sizeof bits );
+
+    std::uint64_t const fraction = bits & 0x000FFFFFFFFFFFFFULL;
+    int const biased = int( bits >> 52 & 0x7FF );
+
+    if ( 0x7FF == biased || ( 0 == biased && 0 == fraction ) )
+        return 0;
+
+    char digits[ 32 ];
+    int exponent = 0;
+
+    int const length = grisu3( biased ? fraction | 0x0010000000000000ULL : fraction,
+        biased ? biased - 1075 : -1074, 0 == fraction && biased > 1, digits, exponent );
+
+    return length ? format_digits( buf, size, bits >> 63, digits, length, exponent, std::numeric_limits<double>::digits10 ) : 0;
+}
+
+inline int print_shortest( char * const buf, std::size_t const size, float const value )
+{
+    std::uint32_t bits = 0;
+    std::memcpy( &bits, &value, sizeof bits );
+
+    std::uint32_t const fraction = bits & 0x007FFFFFu;
+    int const biased = int( bits >> 23 & 0xFF );
+
+    if ( 0xFF == biased || ( 0 == biased && 0 == fraction ) )
+        return 0;
+
+    char digits[ 32 ];
+    int exponent = 0;
+
+    int const length = grisu3( biased ? fraction | 0x00800000u : fraction,
+        biased ? biased - 150 : -149, 0 == fraction && biased > 1, digits, exponent );
+
+    return length ? format_digits( buf, size, bits >> 31, digits, length, exponent, std::numeric_limits<float>::digits10 ) : 0;
+}
+
+/// long double has more significant bits than Grisu3 handles with 64-bit integers.
+
+inline int print_shortest( char * const, std::size_t const, long double const )
+{
+    return 0;
+}
+
+#ifdef __cpp_lib_to_chars
+
+/// value into buf as "%g" formats it in the "C" locale; returns the length.
+
+template< typename T >
+int print_general( char * const buf, std::size_t const size, T const value )
+{
+    char text[ 64 ];
+
+    std::to_chars_result const result = std::to_chars( text, text + sizeof text, value, std::chars_format::general, 6 );
+
+    return format_digits_text( buf, size, text, int( result.ptr - text ) );
+}
+
+/// shortest representation of any value with std::to_chars(), laid out as print_shortest() does.
+
+template< typename T >
+int print_round_trip( char * const buf, std::size_t const size, T const value )
+{
+    char text[ 64 ];
+
+    std::to_chars_result const result = std::to_chars( text, text + sizeof text, value, std::chars_format::scientific );
+
+    char const * p = text;
+    bool const negative = '-' == *p;
+
+    if ( negative )
+        ++p;
+
+    if ( *p < '0' || '9' < *p )
+        return format_digits_text( buf, size, text, int( result.ptr - text ) );
+
+    char digits[ 40 ];
+    int length = 0;
+
+    for ( ; 'e' != *p; ++p )
+    {
+        if ( '.' != *p )
+            digits[ length++ ] = *p;
+    }
+
+    bool const negative_exponent = '-' == *++p;
+    int exponent = 0;
+
+    for ( ++p; p != result.ptr; ++p )
+        exponent = 10 * exponent + ( *p - '0' );
+
+    return format_digits( buf, size, negative, digits, length,
+        ( negative_exponent ? -exponent : exponent ) - length + 1, std::numeric_limits<T>::digits10 );
+}
+
+#else // __cpp_lib_to_chars
+
+template< typename T >
+int print_general( char * const buf, std::size_t const size, T const value )
+{
+    return c_decimal_point( buf, size, print_float( buf, size, 6, value ) );
+}
+
+/// the fewest digits of "%.*g" that strtod() reads back in the current locale, with '.' as decimal point.
+
+template< typename T >
+int print_round_trip( char * const buf, std::size_t const size, T const value )
+{
+    typedef typename std::conditional< std::is_same<T, long double>::value, long double, double >::type printed;
+
+    int length = 0;
+
+    for ( int precision = std::numeric_limits<T>::digits10; precision <= std::numeric_limits<T>::max_digits10; ++precision )
+    {
+        length = print_float( buf, size, precision, printed( value ) );
+
+        if ( read_float( buf, value ) == value )
+            break;
+    }
+    return c_decimal_point( buf, size, length );
+}
+
+#endif // __cpp_lib_to_chars
+
+/**
+ * magnitude into buf, as to_magnitude_string() gives it, or with the fewest
+ * significant digits that read back as the same value; returns the length.
+ */
+template< typename T >
+typename std::enable_if< std::is_floating_point<T>::value, int >::type
+print_magnitude( char * const buf, std::size_t const size, T const value, bool const shortest )
+{
+    typedef typename std::conditional< std::is_same<T, long double>::value, long double, double >::type printed;
+
+    if ( !shortest )
+        return print_general( buf, size, printed( value ) );
+
+    int const length = print_shortest( buf, size, value );
+
+    return length > 0 ? length : print_round_trip( buf, size, value );
+}
+
+template< typename T >
+typename std::enable_if< std::is_integral<T>::value && std::is_signed<T>::value, int >::type
+print_magnitude( char * const buf, std::size_t const size, T const value, bool const /* shortest */ )
+{
+    return std::snprintf( buf, size, "%lld", static_cast<long long>( value ) );
+}
+
+template< typename T >
+typename std::enable_if< std::is_integral<T>::value && std::is_unsigned<T>::value, int >::type
+print_magnitude( char * const buf, std::size_t const size, T const value, bool const /* shortest */ )
+{
+    return std::snprintf( buf, size, "%llu", static_cast<unsigned long long>( value ) );
+}
+
+#if PHYS_UNITS_IO_DEFINE
+
+PHYS_UNITS_IO_API std::string to_magnitude_string( long double const value )
+{
+    char buf[ 64 ];
+
+    return std::string( buf, print_magnitude( buf, sizeof buf, value, false ) );
+}
+
+PHYS_UNITS_IO_API std::string to_magnitude_string( double const value )
+{
+    char buf[ 64 ];
+
+    return std::string( buf, print_magnitude( buf, sizeof buf, value, false ) );
+}
+
+#endif // PHYS_UNITS_IO_DEFINE
+
+} // namespace detail
+
 /// quantity error base class (not used by quantity itself).
 
 struct quantity_error : public std::runtime_error
@@ -55,49 +776,215 @@ struct prefix_error : public quantity_error
         : quantity_error( text ) { }
 };
 
-/// return factor for given prefix.
+/*
+ * SI prefixes without allocation: prefix_exponent() gives the power of ten
+ * of a prefix symbol, prefix_symbol() the symbol of a power of ten, which
+ * the engineering format uses, and prefix() the factor of a symbol.
+ */
+
+/// namespace detail.
+
+namespace detail {
 
-inline Rep prefix( std::string const prefix_ )
+/// power of ten of an unrecognized prefix symbol.
+
+PHYS_UNITS_CONSTANT int no_prefix = INT_MIN;
+
+/// true if the strings are equal.
+
+constexpr bool equal( char const * const x, char const * const y )
 {
-    std::map<std::string, Rep> table
-    {
-        { "m", milli },
-        { "k", kilo  },
-        { "u", micro },
-        { "M", mega  },
-        { "n", nano  },
-        { "G", giga  },
-        { "p", pico  },
-        { "T", tera  },
-        { "f", femto },
-        { "P", peta  },
-        { "a", atto  },
-        { "E", exa   },
-        { "z", zepto },
-        { "Z", zetta },
-        { "y", yocto },
-        { "Y", yotta },
-        { "h", hecto },
-        { "da", deka },
-        { "d", deci  },
-        { "c", centi },
-    };
+    return *x == *y && ( *x == '\0' || equal( x + 1, y + 1 ) );
+}
+
+/// power of ten of a single-character prefix symbol.
+
+constexpr int prefix_exponent( char const c )
+{
+    return c == 'Y' ?  24 : c == 'Z' ?  21 : c == 'E' ?  18 : c == 'P' ?  15 :
+           c == 'T' ?  12 : c == 'G' ?   9 : c == 'M' ?   6 : c == 'k' ?   3 :
+           c == 'h' ?   2 : c == 'd' ?  -1 : c == 'c' ?  -2 : c == 'm' ?  -3 :
+           c == 'u' ?  -6 : c == 'n' ?  -9 : c == 'p' ? -12 : c == 'f' ? -15 :
+           c == 'a' ? -18 : c == 'z' ? -21 : c == 'y' ? -24 : no_prefix;
+}
+
+/// factor of the power of ten of a prefix.
+
+constexpr long double prefix_factor( int const exponent )
+{
+    return exponent ==  24 ? yotta : exponent ==  21 ? zetta : exponent ==  18 ? exa   : exponent ==  15 ? peta  :
+           exponent ==  12 ? tera  : exponent ==   9 ? giga  : exponent ==   6 ? mega  : exponent ==   3 ? kilo  :
+           exponent ==   2 ? hecto : exponent ==   1 ? deka  : exponent ==  -1 ? deci  : exponent ==  -2 ? centi :
+           exponent ==  -3 ? milli : exponent ==  -6 ? micro : exponent ==  -9 ? nano  : exponent == -12 ? pico  :
+           exponent == -15 ? femto : exponent == -18 ? atto  : exponent == -21 ? zepto : exponent == -24 ? yocto : 1;
+}
+
+} // namespace detail
+
+/// power of ten of a prefix symbol, e.g. 3 for "k" and 1 for "da"; detail::no_prefix if unrecognized.
+
+constexpr int prefix_exponent( char const * const symbol )
+{
+    return detail::equal( symbol, ENG_FORMAT_MICRO_GLYPH ) ? -6
+         : symbol[0] != '\0' && symbol[1] == '\0' ? detail::prefix_exponent( symbol[0] )
+         : detail::equal( symbol, "da" ) ? 1 : detail::no_prefix;
+}
+
+/// prefix symbol of a power of ten, e.g. "k" for 3 and "" for 0; nullptr if there is none.
+
+constexpr char const * prefix_symbol( int const exponent )
+{
+    return exponent ==  24 ? "Y"  : exponent ==  21 ? "Z" : exponent ==  18 ? "E" : exponent ==  15 ? "P" :
+           exponent ==  12 ? "T"  : exponent ==   9 ? "G" : exponent ==   6 ? "M" : exponent ==   3 ? "k" :
+           exponent ==   2 ? "h"  : exponent ==   1 ? "da": exponent ==   0 ? ""  : exponent ==  -1 ? "d" :
+           exponent ==  -2 ? "c"  : exponent ==  -3 ? "m" : exponent ==  -6 ? ENG_FORMAT_MICRO_GLYPH :
+           exponent ==  -9 ? "n"  : exponent == -12 ? "p" : exponent == -15 ? "f" : exponent == -18 ? "a" :
+           exponent == -21 ? "z"  : exponent == -24 ? "y" : nullptr;
+}
+
+/// return factor for given prefix.
+
+PHYS_UNITS_IO_API Rep prefix( char const * const symbol );
 
-    auto pos = table.find( prefix_ );
+PHYS_UNITS_IO_API Rep prefix( std::string const & symbol );
 
-    if ( pos == table.end() )
+#if PHYS_UNITS_IO_DEFINE
+
+PHYS_UNITS_IO_API Rep prefix( char const * const symbol )
+{
+    int const exponent = prefix_exponent( symbol );
+
+    if ( exponent == detail::no_prefix )
     {
-        throw prefix_error( "quantity: unrecognized prefix '" + prefix_ + "'" );
+        throw prefix_error( std::string( "quantity: unrecognized prefix '" ) + symbol + "'" );
     }
 
-    return pos->second;
+    return Rep( detail::prefix_factor( exponent ) );
 }
 
+PHYS_UNITS_IO_API Rep prefix( std::string const & symbol )
+{
+    return prefix( symbol.c_str() );
+}
+
+#endif // PHYS_UNITS_IO_DEFINE
+
+namespace detail {
+
+/// characters as a type, with the string in static storage.
+
+template< char... C >
+struct chars
+{
+    static constexpr char value[ sizeof...( C ) + 1 ] = { C..., '\0' };
+};
+
+template< char... C >
+constexpr char chars<C...>::value[ sizeof...( C ) + 1 ];
+
+/// concatenation of chars.
+
+template< typename... S >
+struct concat;
+
+template<>
+struct concat<>
+{
+    typedef chars<> type;
+};
+
+template< char... C >
+struct concat< chars<C...> >
+{
+    typedef chars<C...> type;
+};
+
+template< char... C, char... D, typename... S >
+struct concat< chars<C...>, chars<D...>, S... > : concat< chars<C..., D...>, S... > { };
+
+/// decimal digits of N.
+
+template< unsigned N, bool = ( N < 10 ) >
+struct digits
+{
+    typedef typename concat< typename digits< N / 10 >::type, chars< char( '0' + N % 10 ) > >::type type;
+};
+
+template< unsigned N >
+struct digits< N, true >
+{
+    typedef chars< char( '0' + N ) > type;
+};
+
+/// exponent as emitted after a label: none for 1, "+2", "-1" etc.
+
+template< int Exp, bool = ( Exp == 1 ) >
+struct exponent_chars
+{
+    typedef typename concat< chars< Exp < 0 ? '-' : '+' >, typename digits< unsigned( Exp < 0 ? -Exp : Exp ) >::type >::type type;
+};
+
+template< int Exp >
+struct exponent_chars< Exp, true >
+{
+    typedef chars<> type;
+};
+
+/// " label exponent" of a single dimension, nothing if its exponent is zero.
+
+template< typename Label, int Exp >
+struct unit_term
+{
+    typedef typename concat< chars<' '>, Label, typename exponent_chars< Exp >::type >::type type;
+};
+
+template< typename Label >
+struct unit_term< Label, 0 >
+{
+    typedef chars<> type;
+};
+
+/// chars without the leading space.
+
+template< typename S >
+struct trim
+{
+    typedef S type;
+};
+
+template< char... C >
+struct trim< chars<' ', C...> >
+{
+    typedef chars<C...> type;
+};
+
+/// the units-and-exponents of Dims, e.g. "m+2 kg s-2".
+
+template< typename Dims >
+struct unit_symbol
+{
+    typedef typename trim< typename concat<
+        typename unit_term< chars<'m'>,          Dims::dim1 >::type,
+        typename unit_term< chars<'k','g'>,      Dims::dim2 >::type,
+        typename unit_term< chars<'s'>,          Dims::dim3 >::type,
+        typename unit_term< chars<'A'>,          Dims::dim4 >::type,
+        typename unit_term< chars<'K'>,          Dims::dim5 >::type,
+        typename unit_term< chars<'m','o','l'>,  Dims::dim6 >::type,
+        typename unit_term< chars<'c','d'>,      Dims::dim7 >::type
+    >::type >::type type;
+};
+
+} // namespace detail
+
 /**
  * Provide SI units-and-exponents in as close to NIST-specified format as possible with plain ascii.
  *
  * Made presentation customizable by specialization of template.
  * Adapted by Martin Moene, 21 February 2012.
+ *
+ * The name and symbol are strings in static storage; the units-and-exponents
+ * are generated at compile time from the dimensions, so that printing a
+ * quantity does not build its unit symbol.
  */
 template <typename Dims>
 struct unit_info
@@ -111,49 +998,16 @@ struct unit_info
 
     /// provide unit's name.
 
-    static std::string name()
+    static char const * name()
     {
         return symbol();
     }
 
     /// provide unit's symbol.
 
-    static std::string symbol()
+    static char const * symbol()
     {
-        std::ostringstream os;
-
-        bool first = true;
-
-        emit_dim( os, "m",   Dims::dim1, first );
-        emit_dim( os, "kg",  Dims::dim2, first );
-        emit_dim( os, "s",   Dims::dim3, first );
-        emit_dim( os, "A",   Dims::dim4, first );
-        emit_dim( os, "K",   Dims::dim5, first );
-        emit_dim( os, "mol", Dims::dim6, first );
-        emit_dim( os, "cd",  Dims::dim7, first );
-
-        return os.str();
-    }
-
-    /// emit a single dimension.
-
-    static void emit_dim( std::ostream & os, const char * label, int exp, bool & first )
-    {
-        if( exp == 0 )
-            return;
-
-        if ( first )
-            first = false;
-        else
-            os << " ";
-
-        os << label;
-
-        if( exp > 1 )
-            os << "+";
-
-        if( exp != 1 )
-            os << exp;
+        return detail::unit_symbol<Dims>::type::value;
     }
 };
 
@@ -181,6 +1035,17 @@ struct unit_info
 # include "quantity_io_kelvin.hpp"
 #endif
 
+/*
+ * The library instantiates the IO functions with the names and symbols of
+ * all unit headers, so every translation unit that uses it must see them.
+ */
+#ifdef PHYS_UNITS_IO_LIBRARY
+# ifdef QUANTITY_USE_CELSIUS
+#  error PHYS_UNITS_IO_LIBRARY presents temperature in kelvin, do not define QUANTITY_USE_CELSIUS
+# endif
+# include "quantity_io_symbols.hpp"
+#endif
+
 namespace phys { namespace units {
 
 /// magnitude as string.
@@ -188,9 +1053,7 @@ namespace phys { namespace units {
 template< typename  Dims, typename T >
 std::string to_magnitude( quantity<Dims, T> const & q )
 {
-    std::ostringstream os;
-    os << q.magnitude();
-    return os.str();
+    return detail::to_magnitude_string( q.magnitude() );
 }
 
 /// unit name.
@@ -211,13 +1074,17 @@ std::string to_unit_symbol( quantity<Dims, T> const & /* q */)
 
 /// string representation of value.
 
-inline std::string to_string( long double const value )
+PHYS_UNITS_IO_API std::string to_string( long double const value );
+
+#if PHYS_UNITS_IO_DEFINE
+
+PHYS_UNITS_IO_API std::string to_string( long double const value )
 {
-    std::ostringstream os;
-    os << value;
-    return os.str();
+    return detail::to_magnitude_string( value );
 }
 
+#endif // PHYS_UNITS_IO_DEFINE
+
 /// namespace io.
 
 namespace io {
@@ -227,7 +1094,7 @@ namespace io {
 template< typename Dims, typename T >
 std::ostream & operator<<( std::ostream & os, quantity<Dims, T> const & q )
 {
-    return os << q.magnitude() << " " << to_unit_symbol( q );
+    return os << q.magnitude() << " " << unit_info<Dims>::symbol();
 }
 
 /// quantity string representation.
@@ -235,13 +1102,70 @@ std::ostream & operator<<( std::ostream & os, quantity<Dims, T> const & q )
 template< typename Dims, typename T >
 std::string to_string( quantity<Dims, T> const & q )
 {
-    std::ostringstream os;
-    os << q;
-    return os.str();
+    return to_magnitude( q ).append( " " ).append( to_unit_symbol( q ) );
+}
+
+/// magnitude formats of to_chars().
+
+enum class chars_format
+{
+    general,    ///< as to_string(): %g, six significant digits, which may not read back the same
+    shortest,   ///< the fewest significant digits that read back as the same magnitude
+};
+
+/// result of to_chars(), as that of std::to_chars() in C++17.
+
+struct to_chars_result
+{
+    char * ptr;     ///< one past the last character written, or last
+    std::errc ec;   ///< std::errc(), or std::errc::value_too_large
+};
+
+/**
+ * quantity representation into [first, last), without a terminating null
+ * character; does not allocate. By default, as std::to_chars(), with the
+ * shortest magnitude that reads back the same; as to_string() with general.
+ */
+template< typename Dims, typename T >
+to_chars_result to_chars( char * const first, char * const last, quantity<Dims, T> const & q, chars_format const fmt = chars_format::shortest )
+{
+    char magnitude[ 64 ];
+
+    std::size_t const magnitude_length = detail::print_magnitude( magnitude, sizeof magnitude, q.magnitude(), chars_format::shortest == fmt );
+
+    char const * const symbol = unit_info<Dims>::symbol();
+    std::size_t const symbol_length = std::strlen( symbol );
+
+    if ( std::size_t( last - first ) < magnitude_length + 1 + symbol_length )
+        return { last, std::errc::value_too_large };
+
+    std::memcpy( first, magnitude, magnitude_length );
+    first[ magnitude_length ] = ' ';
+    std::memcpy( first + magnitude_length + 1, symbol, symbol_length );
+
+    return { first + magnitude_length + 1 + symbol_length, std::errc() };
 }
 
 } // namespace io
 
+#ifdef PHYS_UNITS_IO_LIBRARY
+
+// instantiated in the library, see PHYS_UNITS_IO_DIMENSIONS:
+
+#define PHYS_UNITS_IO_INSTANTIATE( Dims ) \
+    PHYS_UNITS_IO_EXTERN std::string to_magnitude  ( quantity< Dims, Rep > const & ); \
+    PHYS_UNITS_IO_EXTERN std::string to_unit_name  ( quantity< Dims, Rep > const & ); \
+    PHYS_UNITS_IO_EXTERN std::string to_unit_symbol( quantity< Dims, Rep > const & ); \
+    PHYS_UNITS_IO_EXTERN std::string io::to_string ( quantity< Dims, Rep > const & ); \
+    PHYS_UNITS_IO_EXTERN io::to_chars_result io::to_chars( char *, char *, quantity< Dims, Rep > const &, io::chars_format ); \
+    PHYS_UNITS_IO_EXTERN std::ostream & io::operator<<( std::ostream &, quantity< Dims, Rep > const & );
+
+PHYS_UNITS_IO_DIMENSIONS( PHYS_UNITS_IO_INSTANTIATE )
+
+#undef PHYS_UNITS_IO_INSTANTIATE
+
+#endif // PHYS_UNITS_IO_LIBRARY
+
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_HPP_INCLUDED
@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< electric_current_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "ampere"; }
-   static std::string symbol() { return "A"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "ampere"; }
+   static char const * symbol() { return "A"; }
 };
 
 }} // namespace phys::units
@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_BECQUEREL_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_becquerel.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< activity_of_a_nuclide_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "becquerel"; }
-    static std::string symbol() { return "Bq"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "becquerel"; }
+    static char const * symbol() { return "Bq"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Bq, activity_of_a_nuclide_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_BECQUEREL_HPP_INCLUDED
@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< luminous_intensity_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "candela"; }
-   static std::string symbol() { return "cd"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "candela"; }
+   static char const * symbol() { return "cd"; }
 };
 
 }} // namespace phys::units
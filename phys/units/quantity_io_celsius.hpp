@@ -27,9 +27,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< thermodynamic_temperature_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "celsius"; }
-    static std::string symbol() { return "C"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "celsius"; }
+    static char const * symbol() { return "C"; }
 };
 
 namespace literals {
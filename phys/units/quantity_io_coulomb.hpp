@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_COULOMB_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_coulomb.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< electric_charge_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "coulomb"; }
-    static std::string symbol() { return "C"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "coulomb"; }
+    static char const * symbol() { return "C"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( C, electric_charge_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_COULOMB_HPP_INCLUDED
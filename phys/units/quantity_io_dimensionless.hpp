@@ -26,9 +26,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< dimensionless_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "(dimensionless)"; }
-    static std::string symbol() { return "[]"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "(dimensionless)"; }
+    static char const * symbol() { return "[]"; }
 };
 
 }} // namespace phys::units
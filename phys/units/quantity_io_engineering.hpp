@@ -26,16 +26,15 @@
 #include "phys/units/quantity_io.hpp"
 
 #include <cmath>
-#include <iomanip>
+#include <cstdio>
+#include <iosfwd>
 #include <limits>
-#include <sstream>
+#include <string>
 
 /*
- * Note: micro, , may not work everywhere, so you can define a glyph yourself:
+ * The prefixes are those of prefix_symbol(), see quantity_io.hpp; define
+ * ENG_FORMAT_MICRO_GLYPH to change the one of micro, "u" by default.
  */
-#ifndef ENG_FORMAT_MICRO_GLYPH
-# define ENG_FORMAT_MICRO_GLYPH "u"
-#endif
 
 /// namespace phys.
 
@@ -49,32 +48,6 @@ namespace units {
 
 namespace detail {
 
-char const * const prefixes[/*exp*/][2][9] =
-{
-    {
-        {   "",   "m",   ENG_FORMAT_MICRO_GLYPH
-                            ,   "n",    "p",    "f",    "a",    "z",    "y", },
-        {   "",   "k",   "M",   "G",    "T",    "P",    "E",    "Z",    "Y", },
-    },
-    {
-        { "e0", "e-3", "e-6", "e-9", "e-12", "e-15", "e-18", "e-21", "e-24", },
-        { "e0",  "e3",  "e6",  "e9",  "e12",  "e15",  "e18",  "e21",  "e24", },
-    },
-};
-
-template<typename T, size_t N>
-constexpr size_t dimenson_of( T(&)[N] )
-{
-    return N;
-}
-
-constexpr int prefix_count = dimenson_of( prefixes[false][false]  );
-
-inline int sign( int const value )
-{
-    return value == 0 ? +1 : value / std::abs( value );
-}
-
 inline bool iszero( double const value )
 {
     return FP_ZERO == std::fpclassify( value );
@@ -90,16 +63,16 @@ inline int precision( double const scaled, int const digits )
     return iszero( scaled ) ? digits - 1 : digits - std::log10( std::abs( scaled ) ) - 2 * std::numeric_limits<double>::epsilon();
 }
 
-inline std::string prefix_or_exponent( bool const exponential, int const degree )
+inline std::string exponent( int const degree )
 {
-    return std::string( exponential || 0 == degree ? "" : " " ) + prefixes[ exponential ][ sign(degree) > 0 ][ std::abs( degree ) ];
+    char text[ 16 ];
+    std::snprintf( text, sizeof text, "e%d", 3 * degree );
+    return text;
 }
 
-inline std::string exponent( int const degree )
+inline std::string prefix_or_exponent( bool const exponential, int const degree )
 {
-    std::ostringstream os;
-    os << "e" << 3 * degree;
-    return os.str();
+    return exponential ? exponent( degree ) : std::string( 0 == degree ? "" : " " ) + prefix_symbol( 3 * degree );
 }
 
 inline std::string bracket( std::string const unit )
@@ -112,8 +85,13 @@ inline std::string bracket( std::string const unit )
 /**
  * convert real number to prefixed or exponential notation, optionally followed by a unit.
  */
-inline std::string
-to_engineering_string( double const value, int const digits = 3, bool exponential = false, bool const showpos = false, std::string const unit = "" )
+PHYS_UNITS_IO_API std::string
+to_engineering_string( double const value, int const digits = 3, bool exponential = false, bool const showpos = false, std::string const unit = "" );
+
+#if PHYS_UNITS_IO_DEFINE
+
+PHYS_UNITS_IO_API std::string
+to_engineering_string( double const value, int const digits, bool exponential, bool const showpos, std::string const unit )
 {
     using namespace detail;
 
@@ -124,7 +102,7 @@ to_engineering_string( double const value, int const digits = 3, bool exponentia
 
     std::string factor;
 
-    if ( std::abs( degree ) < prefix_count )
+    if ( prefix_symbol( 3 * degree ) != nullptr )
     {
         factor = prefix_or_exponent( exponential, degree );
     }
@@ -134,17 +112,15 @@ to_engineering_string( double const value, int const digits = 3, bool exponentia
         factor = exponent( degree );
     }
 
-    std::ostringstream os;
-
     const double scaled = value * std::pow( 1000.0, -degree );
 
     const std::string space = ( 0 == degree || exponential ) && unit.length() ? " ":"";
 
-    os << std::fixed << (showpos ? std::showpos : std::noshowpos) << std::setprecision( precision(scaled, digits) ) << scaled << factor << space << bracket( unit );
-
-    return os.str();
+    return format( showpos ? "%+.*f" : "%.*f", precision( scaled, digits ), scaled ) + factor + space + bracket( unit );
 }
 
+#endif // PHYS_UNITS_IO_DEFINE
+
 namespace io {
 namespace eng {
 
@@ -163,6 +139,20 @@ inline std::ostream & operator<<( std::ostream & os, quantity< Dims, T > const &
 } // namespace eng
 } // namespace io
 
+#ifdef PHYS_UNITS_IO_LIBRARY
+
+// instantiated in the library, see PHYS_UNITS_IO_DIMENSIONS:
+
+#define PHYS_UNITS_IO_ENG_INSTANTIATE( Dims ) \
+    PHYS_UNITS_IO_EXTERN std::string io::eng::to_string( quantity< Dims, Rep > const &, int, bool, bool ); \
+    PHYS_UNITS_IO_EXTERN std::ostream & io::eng::operator<<( std::ostream &, quantity< Dims, Rep > const & );
+
+PHYS_UNITS_IO_DIMENSIONS( PHYS_UNITS_IO_ENG_INSTANTIATE )
+
+#undef PHYS_UNITS_IO_ENG_INSTANTIATE
+
+#endif // PHYS_UNITS_IO_LIBRARY
+
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_ENGINEERING_HPP_INCLUDED
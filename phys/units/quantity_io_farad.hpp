@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_FARAD_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_farad.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< capacitance_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "farad"; }
-    static std::string symbol() { return "F"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "farad"; }
+    static char const * symbol() { return "F"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( F, capacitance_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_FARAD_HPP_INCLUDED
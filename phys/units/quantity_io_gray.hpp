@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_GRAY_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_gray.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< absorbed_dose_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "gray"; }
-    static std::string symbol() { return "Gy"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "gray"; }
+    static char const * symbol() { return "Gy"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Gy, absorbed_dose_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_GRAY_HPP_INCLUDED
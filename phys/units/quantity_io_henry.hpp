@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_HENRY_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_henry.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< inductance_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "henry"; }
-    static std::string symbol() { return "H"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "henry"; }
+    static char const * symbol() { return "H"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( H, inductance_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_HENRY_HPP_INCLUDED
@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_HERTZ_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_hertz.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< frequency_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "hertz"; }
-   static std::string symbol() { return "Hz"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "hertz"; }
+   static char const * symbol() { return "Hz"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Hz, frequency_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_HERTZ_HPP_INCLUDED
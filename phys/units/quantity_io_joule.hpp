@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_JOULE_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_joule.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< energy_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "joule"; }
-    static std::string symbol() { return "J"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "joule"; }
+    static char const * symbol() { return "J"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( J, energy_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_JOULE_HPP_INCLUDED
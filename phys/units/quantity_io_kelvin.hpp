@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< thermodynamic_temperature_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "kelvin"; }
-    static std::string symbol() { return "K"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "kelvin"; }
+    static char const * symbol() { return "K"; }
 };
 
 }} // namespace phys::units
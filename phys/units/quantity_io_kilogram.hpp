@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< mass_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "kilogram"; }
-   static std::string symbol() { return "kg"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "kilogram"; }
+   static char const * symbol() { return "kg"; }
 };
 
 }} // namespace phys::units
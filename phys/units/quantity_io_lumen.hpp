@@ -17,26 +17,13 @@
 #define PHYS_UNITS_QUANTITY_IO_LUMEN_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_lumen.hpp"
 
-namespace phys { namespace units {
-
-/**
- * lumen, [lm].
+/*
+ * lumen, [lm]: cd sr has the dimensions of the candela, as the steradian is
+ * dimensionless, and quantity_io.hpp already names those "candela", "cd".
+ * This header therefore gives the literals only.
  */
-template<>
-struct unit_info< luminous_flux_d >
-{
-    static bool        single() { return true; }
-    static std::string name()   { return "lumen"; }
-    static std::string symbol() { return "lm"; }
-};
-
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( lm, luminous_flux_d )
-
-}
-}} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_LUMEN_HPP_INCLUDED
 
@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_LUX_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_lux.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< illuminance_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "lux"; }
-    static std::string symbol() { return "lx"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "lux"; }
+    static char const * symbol() { return "lx"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( lx, illuminance_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_LUX_HPP_INCLUDED
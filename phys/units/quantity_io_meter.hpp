@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< length_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "meter"; }
-   static std::string symbol() { return "m"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "meter"; }
+   static char const * symbol() { return "m"; }
 };
 
 }} // namespace phys::units
@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< amount_of_substance_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "mole"; }
-   static std::string symbol() { return "mol"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "mole"; }
+   static char const * symbol() { return "mol"; }
 };
 
 }} // namespace phys::units
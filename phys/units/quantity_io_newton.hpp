@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_NEWTON_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_newton.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< force_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "newton"; }
-    static std::string symbol() { return "N"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "newton"; }
+    static char const * symbol() { return "N"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( N, force_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_NEWTON_HPP_INCLUDED
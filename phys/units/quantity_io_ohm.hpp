@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_OHM_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_ohm.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< electric_resistance_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "ohm"; }
-    static std::string symbol() { return "Ohm"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "ohm"; }
+    static char const * symbol() { return "Ohm"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Ohm, electric_resistance_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_OHM_HPP_INCLUDED
@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_PASCAL_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_pascal.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< pressure_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "pascal"; }
-    static std::string symbol() { return "Pa"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "pascal"; }
+    static char const * symbol() { return "Pa"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Pa, pressure_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_PASCAL_HPP_INCLUDED
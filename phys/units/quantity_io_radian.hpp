@@ -24,8 +24,8 @@ namespace phys { namespace units {
 template<>
 struct unit_info< radian_d >
 {
-    static std::string name()   { return "radian"; }
-    static std::string symbol() { return "rad"; }
+    static char const * name()   { return "radian"; }
+    static char const * symbol() { return "rad"; }
 };
 
 namespace literals {
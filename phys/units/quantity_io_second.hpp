@@ -25,9 +25,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< time_interval_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "second"; }
-   static std::string symbol() { return "s"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "second"; }
+   static char const * symbol() { return "s"; }
 };
 
 }} // namespace phys::units
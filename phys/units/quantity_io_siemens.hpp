@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_SIEMENS_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_siemens.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< electric_conductance_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "siemens"; }
-    static std::string symbol() { return "S"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "siemens"; }
+    static char const * symbol() { return "S"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( S, electric_conductance_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_SIEMENS_HPP_INCLUDED
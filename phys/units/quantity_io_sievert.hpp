@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_SIEVERT_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_sievert.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< dose_equivalent_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "sievert"; }
-    static std::string symbol() { return "Sv"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "sievert"; }
+    static char const * symbol() { return "Sv"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Sv, dose_equivalent_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_SIEVERT_HPP_INCLUDED
@@ -26,9 +26,9 @@ namespace phys { namespace units {
 template<>
 struct unit_info< speed_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "Meter per second"; }
-    static std::string symbol() { return "m/s"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "Meter per second"; }
+    static char const * symbol() { return "m/s"; }
 };
 
 namespace literals {
@@ -24,8 +24,8 @@ namespace phys { namespace units {
 template<>
 struct unit_info< steradian_d >
 {
-    static std::string name()   { return "steradian"; }
-    static std::string symbol() { return "sr"; }
+    static char const * name()   { return "steradian"; }
+    static char const * symbol() { return "sr"; }
 };
 
 namespace literals {
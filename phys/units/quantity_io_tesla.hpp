@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_TESLA_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_tesla.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< magnetic_flux_density_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "tesla"; }
-    static std::string symbol() { return "T"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "tesla"; }
+    static char const * symbol() { return "T"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( T, magnetic_flux_density_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_TESLA_HPP_INCLUDED
@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_VOLT_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_volt.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< electric_potential_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "volt"; }
-    static std::string symbol() { return "V"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "volt"; }
+    static char const * symbol() { return "V"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( V, electric_potential_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_VOLT_HPP_INCLUDED
@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_WATT_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_watt.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< power_d >
 {
-   static bool        single() { return true; }
-   static std::string name()   { return "watt"; }
-   static std::string symbol() { return "W"; }
+   static bool         single() { return true; }
+   static char const * name()   { return "watt"; }
+   static char const * symbol() { return "W"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( W, power_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_WATT_HPP_INCLUDED
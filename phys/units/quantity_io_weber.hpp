@@ -17,6 +17,7 @@
 #define PHYS_UNITS_QUANTITY_IO_WEBER_HPP_INCLUDED
 
 #include "phys/units/quantity_io.hpp"
+#include "phys/units/quantity_literals_weber.hpp"
 
 namespace phys { namespace units {
 
@@ -26,16 +27,11 @@ namespace phys { namespace units {
 template<>
 struct unit_info< magnetic_flux_d >
 {
-    static bool        single() { return true; }
-    static std::string name()   { return "weber"; }
-    static std::string symbol() { return "Wb"; }
+    static bool         single() { return true; }
+    static char const * name()   { return "weber"; }
+    static char const * symbol() { return "Wb"; }
 };
 
-namespace literals {
-
-QUANTITY_DEFINE_LITERALS( Wb, magnetic_flux_d )
-
-}
 }} // namespace phys::units
 
 #endif // PHYS_UNITS_QUANTITY_IO_WEBER_HPP_INCLUDED
@@ -0,0 +1,51 @@
+/**
+ * \file quantity_literals.hpp
+ *
+ * \brief   Literals of all named derived SI units.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * The literals of the base units are in quantity.hpp, those of a derived
+ * unit are in quantity_literals_<unit>.hpp, without IO: include that file
+ * for e.g. 3_kJ without the std::string machinery of quantity_io_joule.hpp.
+ * This file includes them all; literal oC is in quantity_io_celsius.hpp.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_LITERALS_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_LITERALS_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include "phys/units/quantity_literals_becquerel.hpp"
+#include "phys/units/quantity_literals_coulomb.hpp"
+#include "phys/units/quantity_literals_farad.hpp"
+#include "phys/units/quantity_literals_gray.hpp"
+#include "phys/units/quantity_literals_henry.hpp"
+#include "phys/units/quantity_literals_hertz.hpp"
+#include "phys/units/quantity_literals_joule.hpp"
+#include "phys/units/quantity_literals_lumen.hpp"
+#include "phys/units/quantity_literals_lux.hpp"
+#include "phys/units/quantity_literals_newton.hpp"
+#include "phys/units/quantity_literals_ohm.hpp"
+#include "phys/units/quantity_literals_pascal.hpp"
+#include "phys/units/quantity_literals_siemens.hpp"
+#include "phys/units/quantity_literals_sievert.hpp"
+#include "phys/units/quantity_literals_tesla.hpp"
+#include "phys/units/quantity_literals_volt.hpp"
+#include "phys/units/quantity_literals_watt.hpp"
+#include "phys/units/quantity_literals_weber.hpp"
+
+#endif // PHYS_UNITS_QUANTITY_LITERALS_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,34 @@
+/**
+ * \file quantity_literals_farad.hpp
+ *
+ * \brief   farad, capacitance, literals.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_LITERALS_FARAD_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_LITERALS_FARAD_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+namespace phys { namespace units {
+
+namespace literals {
+
+QUANTITY_DEFINE_LITERALS( F, capacitance_d )
+
+}
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_LITERALS_FARAD_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,202 @@
+/**
+ * \file quantity_macros.hpp
+ *
+ * \brief   Macros of the quantity library.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * The macros live apart from the declarations, because a module does not
+ * export macros: the partitions of the phys.units module include this file
+ * to define their constants and literals with the same macros as the headers.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_MACROS_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_MACROS_HPP_INCLUDED
+
+/*
+ * namespace-scope constants are inline variables from C++17 on; this gives
+ * them external linkage, so that the phys.units module can export them.
+ */
+#if __cplusplus >= 201703L
+# define PHYS_UNITS_CONSTANT inline constexpr
+#else
+# define PHYS_UNITS_CONSTANT constexpr
+#endif
+
+/*
+ * define PHYS_UNITS_FORCE_INLINE to inline the constructors, magnitude() and
+ * the arithmetic and comparison operators of quantity even without
+ * optimization, so that a debug build runs at nearly the speed of double;
+ * the debugger steps over them, as they are marked artificial.
+ */
+#if defined( PHYS_UNITS_FORCE_INLINE ) && defined( __GNUC__ )
+# define PHYS_UNITS_INLINE inline __attribute__(( always_inline, artificial ))
+#elif defined( PHYS_UNITS_FORCE_INLINE ) && defined( _MSC_VER )
+# define PHYS_UNITS_INLINE __forceinline
+#else
+# define PHYS_UNITS_INLINE
+#endif
+
+/*
+ * define PHYS_UNITS_ERASED to compile quantity<D, T> as a plain T, without
+ * dimensions, for the speed of compilation and of unoptimized code of double;
+ * check the dimensions in another build of the same code, with
+ * PHYS_UNITS_CHECKED, which overrides PHYS_UNITS_ERASED.
+ */
+#if defined( PHYS_UNITS_ERASED ) && defined( PHYS_UNITS_CHECKED )
+# undef PHYS_UNITS_ERASED
+#endif
+
+/*
+ * cooked literals: QUANTITY_DEFINE_LITERALS( pfx, dim ) defines the literals
+ * _pfx with all SI prefixes for dimension dim, in the current namespace and
+ * for float in the nested namespace float_literals.
+ */
+
+#define QUANTITY_DEFINE_SCALING_LITERAL_T( sfx, dim, factor, Type ) \
+    constexpr quantity<dim, Type> operator "" _ ## sfx(unsigned long long x) \
+    { \
+        return detail::from_magnitude< quantity<dim, Type> >::make( Type( factor * x ) ); \
+    } \
+    constexpr quantity<dim, Type> operator "" _ ## sfx(long double x) \
+    { \
+        return detail::from_magnitude< quantity<dim, Type> >::make( Type( factor * x ) ); \
+    }
+
+#define QUANTITY_DEFINE_SCALING_LITERAL( sfx, dim, factor ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( sfx, dim, factor, LiteralRep )
+
+#define QUANTITY_DEFINE_SCALING_LITERALS_T( pfx, dim, fact, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( Y ## pfx, dim, fact * yotta, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( Z ## pfx, dim, fact * zetta, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( E ## pfx, dim, fact * exa  , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( P ## pfx, dim, fact * peta , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( T ## pfx, dim, fact * tera , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( G ## pfx, dim, fact * giga , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( M ## pfx, dim, fact * mega , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( k ## pfx, dim, fact * kilo , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( h ## pfx, dim, fact * hecto, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( da## pfx, dim, fact * deka , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T(      pfx, dim, fact * 1    , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( d ## pfx, dim, fact * deci , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( c ## pfx, dim, fact * centi, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( m ## pfx, dim, fact * milli, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( u ## pfx, dim, fact * micro, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( n ## pfx, dim, fact * nano , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( p ## pfx, dim, fact * pico , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( f ## pfx, dim, fact * femto, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( a ## pfx, dim, fact * atto , Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( z ## pfx, dim, fact * zepto, Type ) \
+    QUANTITY_DEFINE_SCALING_LITERAL_T( y ## pfx, dim, fact * yocto, Type )
+
+#define QUANTITY_DEFINE_SCALING_LITERALS( pfx, dim, fact ) \
+    QUANTITY_DEFINE_SCALING_LITERALS_T( pfx, dim, fact, LiteralRep ) \
+    namespace float_literals { \
+    QUANTITY_DEFINE_SCALING_LITERALS_T( pfx, dim, fact, float ) \
+    }
+
+#define QUANTITY_DEFINE_LITERALS( pfx, dim ) \
+    QUANTITY_DEFINE_SCALING_LITERALS( pfx, dim, 1 )
+
+/*
+ * IO code: define PHYS_UNITS_IO_LIBRARY to take the IO functions of the
+ * dimensions below from the compiled library of projects/gcc/Lib instead
+ * of compiling them inline in each translation unit that prints a quantity.
+ * The library source, phys/units/lib/quantity_io.cpp, also defines
+ * PHYS_UNITS_IO_SOURCE, which turns the extern templates into the explicit
+ * instantiations.
+ */
+#ifdef PHYS_UNITS_IO_LIBRARY
+# define PHYS_UNITS_IO_API
+#else
+# define PHYS_UNITS_IO_API inline
+#endif
+
+#if !defined( PHYS_UNITS_IO_LIBRARY ) || defined( PHYS_UNITS_IO_SOURCE )
+# define PHYS_UNITS_IO_DEFINE 1
+#else
+# define PHYS_UNITS_IO_DEFINE 0
+#endif
+
+#ifdef PHYS_UNITS_IO_SOURCE
+# define PHYS_UNITS_IO_EXTERN template
+#else
+# define PHYS_UNITS_IO_EXTERN extern template
+#endif
+
+/*
+ * the distinct dimensions of quantity_fwd.hpp, one name each, for which
+ * the library instantiates the IO functions with magnitude type Rep.
+ */
+#define PHYS_UNITS_IO_DIMENSIONS( X ) \
+    X( length_d ) \
+    X( mass_d ) \
+    X( time_interval_d ) \
+    X( electric_current_d ) \
+    X( thermodynamic_temperature_d ) \
+    X( amount_of_substance_d ) \
+    X( luminous_intensity_d ) \
+    X( absorbed_dose_d ) \
+    X( absorbed_dose_rate_d ) \
+    X( acceleration_d ) \
+    X( angular_acceleration_d ) \
+    X( area_d ) \
+    X( capacitance_d ) \
+    X( concentration_d ) \
+    X( current_density_d ) \
+    X( dynamic_viscosity_d ) \
+    X( electric_charge_d ) \
+    X( electric_charge_density_d ) \
+    X( electric_conductance_d ) \
+    X( electric_field_strenth_d ) \
+    X( electric_flux_density_d ) \
+    X( electric_potential_d ) \
+    X( electric_resistance_d ) \
+    X( energy_d ) \
+    X( exposure_d ) \
+    X( force_d ) \
+    X( frequency_d ) \
+    X( heat_capacity_d ) \
+    X( heat_density_d ) \
+    X( heat_density_flow_rate_d ) \
+    X( heat_flow_rate_d ) \
+    X( heat_transfer_coefficient_d ) \
+    X( illuminance_d ) \
+    X( inductance_d ) \
+    X( kinematic_viscosity_d ) \
+    X( magnetic_field_strength_d ) \
+    X( magnetic_flux_d ) \
+    X( magnetic_flux_density_d ) \
+    X( magnetic_permeability_d ) \
+    X( mass_density_d ) \
+    X( mass_flow_rate_d ) \
+    X( molar_energy_d ) \
+    X( molar_entropy_d ) \
+    X( permittivity_d ) \
+    X( pressure_d ) \
+    X( speed_d ) \
+    X( specific_heat_capacity_d ) \
+    X( specific_volume_d ) \
+    X( substance_permeability_d ) \
+    X( thermal_conductivity_d ) \
+    X( thermal_insulance_d ) \
+    X( thermal_resistance_d ) \
+    X( thermal_resistivity_d ) \
+    X( volume_d ) \
+    X( volume_flow_rate_d ) \
+    X( wave_number_d )
+
+#endif // PHYS_UNITS_QUANTITY_MACROS_HPP_INCLUDED
+
+/*
+ * end of file
+ */
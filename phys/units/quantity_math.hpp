@@ -0,0 +1,475 @@
+/**
+ * \file quantity_math.hpp
+ *
+ * \brief   Dimension-aware math functions for quantities, spans and arrays.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Scalar functions, in addition to abs(), sqrt(), square() etc. of quantity.hpp:
+ *
+ * - hypot( x, y )      - sqrt( x^2 + y^2 ) without overflow; x, y of equal dimensions.
+ * - fma( x, y, z )     - x * y + z, rounded once; z of the dimensions of x * y.
+ * - rsqrt( x )         - 1 / sqrt( x ); dimensions of 1 / sqrt( x ).
+ * - fast_rsqrt( x )    - approximate rsqrt(), relative error below 1e-5 for
+ *                        float and 1e-10 for double, for magnitudes in float range.
+ *
+ * Angles and other dimensionless results are plain numbers in this library,
+ * so std::sin(), std::exp() etc. apply to a single one directly.
+ *
+ * The element-wise variants abs(), sqrt(), square(), rsqrt(), fast_rsqrt(),
+ * hypot() and fma() of a quantity_span, a quantity_array or an expression
+ * are expressions themselves: assigning them to a span or an array evaluates
+ * them in one vectorizable loop, e.g. r = hypot( x, y ). fma() takes any mix
+ * of ranges and scalars. Dimensionless expressions are ranges of numbers,
+ * e.g. 1 + square( p / ( m * c ) ), and exp(), log(), sin(), cos() and tan()
+ * apply to them element-wise, e.g. x = x0 * exp( -t / tau ); these reject a
+ * range of quantities at compile time.
+ */
+
+#ifndef PHYS_UNITS_QUANTITY_MATH_HPP_INCLUDED
+#define PHYS_UNITS_QUANTITY_MATH_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_array.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * magnitude of a quantity or a number.
+ */
+template< typename D, typename X >
+constexpr X magnitude_of( quantity<D, X> const & x ) { return x.magnitude(); }
+
+template< typename X >
+constexpr EnableIfNumber<X, X> magnitude_of( X const x ) { return x; }
+
+/**
+ * magnitude type of a quantity, or the number type itself.
+ */
+template< typename X >
+struct magnitude_type_of
+{
+    typedef X type;
+};
+
+#ifndef PHYS_UNITS_ERASED
+template< typename D, typename X >
+struct magnitude_type_of< quantity<D, X> >
+{
+    typedef X type;
+};
+#endif
+
+template< typename X >
+using MagnitudeTypeOf = typename magnitude_type_of<X>::type;
+
+/**
+ * type of 1 / sqrt( quantity<D, X> ).
+ */
+template< typename D, typename X >
+using ReciprocalRoot = Power< DimensionsOf< Root<D, 2, X> >, -1, X >;
+
+/**
+ * approximate 1 / sqrt( x ) from an initial estimate from the bit
+ * pattern of a float and Newton-Raphson steps y *= 1.5 - x/2 * y^2.
+ */
+inline float fast_rsqrt_magnitude( float const x )
+{
+    std::uint32_t i;
+    std::memcpy( &i, &x, sizeof i );
+    i = 0x5f375a86u - ( i >> 1 );
+
+    float y;
+    std::memcpy( &y, &i, sizeof y );
+
+    float const h = 0.5f * x;
+
+    y = y * ( 1.5f - h * y * y );
+    y = y * ( 1.5f - h * y * y );
+
+    return y;
+}
+
+template< typename X >
+X fast_rsqrt_magnitude( X const x )
+{
+    X const y = X( fast_rsqrt_magnitude( float( x ) ) );
+
+    return y * ( X( 1.5 ) - X( 0.5 ) * x * y * y );
+}
+
+} // namespace detail
+
+/// hypot( quantity, quantity ).
+
+template< typename D, typename X, typename Y >
+quantity< D, detail::PromoteAdd<X, Y> >
+hypot( quantity<D, X> const & x, quantity<D, Y> const & y )
+{
+    typedef detail::PromoteAdd<X, Y> T;
+
+    using std::hypot;
+
+    return quantity<D, T>( detail::magnitude_tag, hypot( T( x.magnitude() ), T( y.magnitude() ) ) );
+}
+
+/// fma( x, y, z ), x * y + z rounded once; at least one of x, y is a quantity.
+
+template< typename X, typename Y, typename Z >
+typename std::enable_if<
+    !( std::is_arithmetic<X>::value && std::is_arithmetic<Y>::value ) &&
+    !detail::is_quantity_range<X>::value && !detail::is_quantity_range<Y>::value && !detail::is_quantity_range<Z>::value,
+    decltype( std::declval<X>() * std::declval<Y>() + std::declval<Z>() ) >::type
+fma( X const & x, Y const & y, Z const & z )
+{
+    typedef decltype( x * y + z ) R;
+    typedef decltype( detail::magnitude_of( std::declval<R>() ) ) T;
+
+    using std::fma;
+
+    return detail::from_magnitude<R>::make(
+        fma( T( detail::magnitude_of( x ) ), T( detail::magnitude_of( y ) ), T( detail::magnitude_of( z ) ) ) );
+}
+
+/// rsqrt( quantity ).
+
+template< typename D, typename X >
+detail::ReciprocalRoot<D, X>
+rsqrt( quantity<D, X> const & x )
+{
+    static_assert( detail::root<D, 2, X>::all_even_multiples, "root result dimensions must be integral" );
+
+    using std::sqrt;
+
+    return detail::ReciprocalRoot<D, X>( detail::magnitude_tag, X( 1 ) / sqrt( x.magnitude() ) );
+}
+
+/// rsqrt( number ).
+
+template< typename X >
+detail::EnableIfNumber<X, X> rsqrt( X const x )
+{
+    using std::sqrt;
+
+    return X( 1 ) / sqrt( x );
+}
+
+/// fast_rsqrt( quantity ).
+
+template< typename D, typename X >
+detail::ReciprocalRoot<D, X>
+fast_rsqrt( quantity<D, X> const & x )
+{
+    static_assert( detail::root<D, 2, X>::all_even_multiples, "root result dimensions must be integral" );
+    static_assert( std::is_floating_point<X>::value, "fast_rsqrt requires a floating point magnitude" );
+
+    return detail::ReciprocalRoot<D, X>( detail::magnitude_tag, detail::fast_rsqrt_magnitude( x.magnitude() ) );
+}
+
+/// fast_rsqrt( number ).
+
+template< typename X >
+typename std::enable_if< std::is_floating_point<X>::value, X >::type
+fast_rsqrt( X const x )
+{
+    return detail::fast_rsqrt_magnitude( x );
+}
+
+/// namespace detail.
+
+namespace detail {
+
+/// namespace math; the std:: functions for numbers, those above via ADL for quantities.
+
+namespace math {
+
+using std::abs;
+using std::cos;
+using std::exp;
+using std::fma;
+using std::hypot;
+using std::log;
+using std::sin;
+using std::sqrt;
+using std::tan;
+
+/**
+ * element-wise math operations.
+ */
+struct abs_op
+{
+    template< typename X >
+    using result = decltype( abs( std::declval<X>() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return abs( x ); }
+};
+
+struct sqrt_op
+{
+    template< typename X >
+    using result = decltype( sqrt( std::declval<X>() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return sqrt( x ); }
+};
+
+struct square_op
+{
+    template< typename X >
+    using result = decltype( std::declval<X>() * std::declval<X>() );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return x * x; }
+};
+
+struct rsqrt_op
+{
+    template< typename X >
+    using result = decltype( ::phys::units::rsqrt( std::declval<X>() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return ::phys::units::rsqrt( x ); }
+};
+
+struct fast_rsqrt_op
+{
+    template< typename X >
+    using result = decltype( ::phys::units::fast_rsqrt( std::declval<X>() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return ::phys::units::fast_rsqrt( x ); }
+};
+
+struct hypot_op
+{
+    template< typename X, typename Y >
+    using result = decltype( hypot( std::declval<X>(), std::declval<Y>() ) );
+
+    template< typename X, typename Y >
+    static result<X, Y> apply( X const & x, Y const & y ) { return hypot( x, y ); }
+};
+
+struct fma_op
+{
+    template< typename X, typename Y, typename Z >
+    using result = decltype( fma( std::declval<X>(), std::declval<Y>(), std::declval<Z>() ) );
+
+    template< typename X, typename Y, typename Z >
+    static result<X, Y, Z> apply( X const & x, Y const & y, Z const & z ) { return fma( x, y, z ); }
+};
+
+/*
+ * functions of dimensionless elements; the result type is taken from the
+ * magnitude, so that exp() etc. of a range of quantities reach their
+ * static_assert rather than fail on the element type.
+ */
+struct exp_op
+{
+    template< typename X >
+    using result = decltype( exp( std::declval< MagnitudeTypeOf<X> >() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return exp( x ); }
+};
+
+struct log_op
+{
+    template< typename X >
+    using result = decltype( log( std::declval< MagnitudeTypeOf<X> >() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return log( x ); }
+};
+
+struct sin_op
+{
+    template< typename X >
+    using result = decltype( sin( std::declval< MagnitudeTypeOf<X> >() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return sin( x ); }
+};
+
+struct cos_op
+{
+    template< typename X >
+    using result = decltype( cos( std::declval< MagnitudeTypeOf<X> >() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return cos( x ); }
+};
+
+struct tan_op
+{
+    template< typename X >
+    using result = decltype( tan( std::declval< MagnitudeTypeOf<X> >() ) );
+
+    template< typename X >
+    static result<X> apply( X const & x ) { return tan( x ); }
+};
+
+} // namespace math
+
+/**
+ * the elements of range R are numbers.
+ */
+template< typename R >
+struct is_dimensionless_range : std::is_same< DimensionsOf< typename LeafOf<R>::value_type >, dimensionless_d > { };
+
+} // namespace detail
+
+// Element-wise functions; results are expressions.
+
+/// abs( range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::abs_op, R> >
+abs( R const & r )
+{
+    return detail::Unary<detail::math::abs_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// sqrt( range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::sqrt_op, R> >
+sqrt( R const & r )
+{
+    return detail::Unary<detail::math::sqrt_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// square( range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::square_op, R> >
+square( R const & r )
+{
+    return detail::Unary<detail::math::square_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// rsqrt( range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::rsqrt_op, R> >
+rsqrt( R const & r )
+{
+    return detail::Unary<detail::math::rsqrt_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// fast_rsqrt( range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::fast_rsqrt_op, R> >
+fast_rsqrt( R const & r )
+{
+    return detail::Unary<detail::math::fast_rsqrt_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// hypot( range, range )
+
+template< typename RX, typename RY >
+detail::EnableIfRanges<RX, RY, detail::Binary<detail::math::hypot_op, RX, RY> >
+hypot( RX const & x, RY const & y )
+{
+    return detail::make_binary<detail::math::hypot_op>( x, y );
+}
+
+/// fma( x, y, z ) of ranges and scalars, at least one of them a range.
+
+template< typename X, typename Y, typename Z >
+typename std::enable_if<
+    detail::is_quantity_range<X>::value || detail::is_quantity_range<Y>::value || detail::is_quantity_range<Z>::value,
+    detail::Ternary<detail::math::fma_op, X, Y, Z> >::type
+fma( X const & x, Y const & y, Z const & z )
+{
+    return detail::make_ternary<detail::math::fma_op>( x, y, z );
+}
+
+/// exp( dimensionless range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::exp_op, R> >
+exp( R const & r )
+{
+    static_assert( detail::is_dimensionless_range<R>::value, "exp() requires a dimensionless range" );
+
+    return detail::Unary<detail::math::exp_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// log( dimensionless range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::log_op, R> >
+log( R const & r )
+{
+    static_assert( detail::is_dimensionless_range<R>::value, "log() requires a dimensionless range" );
+
+    return detail::Unary<detail::math::log_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// sin( dimensionless range ), e.g. of angles in radians
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::sin_op, R> >
+sin( R const & r )
+{
+    static_assert( detail::is_dimensionless_range<R>::value, "sin() requires a dimensionless range" );
+
+    return detail::Unary<detail::math::sin_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// cos( dimensionless range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::cos_op, R> >
+cos( R const & r )
+{
+    static_assert( detail::is_dimensionless_range<R>::value, "cos() requires a dimensionless range" );
+
+    return detail::Unary<detail::math::cos_op, R>( { detail::make_leaf( r ) } );
+}
+
+/// tan( dimensionless range )
+
+template< typename R >
+detail::EnableIfRange<R, detail::Unary<detail::math::tan_op, R> >
+tan( R const & r )
+{
+    static_assert( detail::is_dimensionless_range<R>::value, "tan() requires a dimensionless range" );
+
+    return detail::Unary<detail::math::tan_op, R>( { detail::make_leaf( r ) } );
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_QUANTITY_MATH_HPP_INCLUDED
+
+/*
+ * end of file
+ */
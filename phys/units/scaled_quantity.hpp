@@ -0,0 +1,547 @@
+/**
+ * \file scaled_quantity.hpp
+ *
+ * \brief   Quantities stored in a unit with a compile-time scale, such as micrometer.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * A quantity keeps its magnitude in coherent SI units, so data that is
+ * recorded in, say, micrometers is multiplied on entry and divided on exit.
+ * A scaled_quantity<Dims, Ratio, T> keeps its magnitude in units of Ratio
+ * times the SI unit, e.g. scaled_quantity<length_d, std::micro>. Conversions
+ * between scales multiply by a single compile-time constant, which is
+ * omitted altogether when the scales are the same.
+ *
+ * The magnitude may be an integer, e.g. scaled_quantity<time_interval_d,
+ * std::nano, std::int64_t> for exact time steps. Integer conversions are
+ * exact; conversions that would truncate, such as to a coarser integer scale
+ * or from floating point, are explicit, and floating point is rounded.
+ * checked_scale_cast() also detects overflow.
+ *
+ * Arithmetic between scaled quantities of the same scale works on the stored
+ * magnitudes directly. Products and quotients combine the scales. Mixing
+ * scales, or mixing with quantity, requires an explicit conversion.
+ */
+
+#ifndef PHYS_UNITS_SCALED_QUANTITY_HPP_INCLUDED
+#define PHYS_UNITS_SCALED_QUANTITY_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/*
+ * declare now, define later.
+ */
+template< typename Dims, typename Ratio, typename T = Rep >
+class scaled_quantity;
+
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * the scaled_quantity types are quantities.
+ */
+template< typename D, typename R, typename T >
+struct is_quantity_kind< scaled_quantity<D, R, T> > : std::true_type { };
+
+/**
+ * multiply by the compile-time ratio R: nothing when R is one, a single
+ * constant for floating point, exact for integers, without overflow
+ * unless the result itself overflows, and multiply, then divide for other
+ * numbers, such as fixed-point, where the constant may not be representable.
+ */
+template< typename R, typename T,
+    int = R::num == R::den ? 0 : std::is_floating_point<T>::value ? 1 : std::numeric_limits<T>::is_integer ? 2 : 3 >
+struct ratio_scale
+{
+    static constexpr T apply( T const x ) { return x; }
+};
+
+template< typename R, typename T >
+struct ratio_scale< R, T, 1 >
+{
+    static constexpr T apply( T const x ) { return x * ( T( R::num ) / T( R::den ) ); }
+};
+
+template< typename R, typename T >
+struct ratio_scale< R, T, 2 >
+{
+    static constexpr T apply( T const x ) { return x / R::den * R::num + x % R::den * R::num / R::den; }
+};
+
+template< typename R, typename T >
+struct ratio_scale< R, T, 3 >
+{
+    static constexpr T apply( T const x ) { return x * T( R::num ) / T( R::den ); }
+};
+
+/**
+ * store a scaled value; floating point is rounded to the nearest integer.
+ */
+template< typename To, typename C,
+    bool = std::numeric_limits<To>::is_integer && std::is_floating_point<C>::value >
+struct round_to
+{
+    static constexpr To apply( C const x ) { return To( x ); }
+};
+
+template< typename To, typename C >
+struct round_to< To, C, true >
+{
+    static constexpr To apply( C const x ) { return To( x < 0 ? x - C( 0.5 ) : x + C( 0.5 ) ); }
+};
+
+/**
+ * the type to scale in: the floating point type if either is one,
+ * otherwise their common type.
+ */
+template< typename To, typename From,
+    int = std::is_floating_point<To>::value ? 1 : std::is_floating_point<From>::value ? 2 : 0 >
+struct scale_type : std::common_type<To, From> { };
+
+template< typename To, typename From >
+struct scale_type< To, From, 1 >
+{
+    typedef typename std::conditional< std::is_floating_point<From>::value, typename std::common_type<To, From>::type, To >::type type;
+};
+
+template< typename To, typename From >
+struct scale_type< To, From, 2 >
+{
+    typedef From type;
+};
+
+/**
+ * x times R as a To, computed in scale_type of To and From.
+ */
+template< typename R, typename To, typename From >
+constexpr To scale( From const x )
+{
+    typedef typename scale_type<To, From>::type C;
+
+    return round_to<To, C>::apply( ratio_scale< typename R::type, C >::apply( C( x ) ) );
+}
+
+/**
+ * whether scale<R, To>() of x, computed in C, gives a value of To. It checks
+ * the value that scale() actually converts: floating point after rounding,
+ * integers in the intmax_t arithmetic of ratio_scale, including its own
+ * overflow. Other types, such as fixed-point, may overflow inside their own
+ * arithmetic, so they compare x times R as long double instead.
+ */
+template< typename R, typename To, typename C,
+    int = std::is_floating_point<C>::value ? 1 : std::numeric_limits<C>::is_integer ? 2 : 3 >
+struct scale_in_range
+{
+    static bool apply( C const x )
+    {
+        long double const y = static_cast<long double>( x ) * R::num / R::den;
+
+        return !( y > static_cast<long double>( std::numeric_limits<To>::max() ) ||
+                  y < static_cast<long double>( std::numeric_limits<To>::lowest() ) );
+    }
+};
+
+template< typename R, typename To, typename C >
+struct scale_in_range< R, To, C, 1 >
+{
+    static bool apply( C const x )
+    {
+        typedef std::numeric_limits<To> limits;
+
+        C const y = ratio_scale< R, C >::apply( x );
+
+        if ( !limits::is_integer )
+            return !( y > C( limits::max() ) || y < C( limits::lowest() ) );
+
+        // the integer round_to converts, below the exclusive bound 2^digits:
+
+        C const z = std::trunc( y < 0 ? y - C( 0.5 ) : y + C( 0.5 ) );
+
+        return z >= C( limits::lowest() ) && z < std::ldexp( C( 1 ), limits::digits );
+    }
+};
+
+template< typename R, typename To, typename C >
+struct scale_in_range< R, To, C, 2 >
+{
+    typedef decltype( C() * std::intmax_t() ) W;
+    typedef std::numeric_limits<W> limits;
+
+    static bool apply( C const x )
+    {
+        W const num = W( R::num );
+        W const den = W( R::den );
+        W const q   = W( x ) / den;
+        W const r   = W( x ) % den;
+
+        if ( q > limits::max() / num || q < limits::lowest() / num ||
+             r > limits::max() / num || r < limits::lowest() / num )
+            return false;
+
+        W const a = q * num;
+        W const b = r * num / den;
+
+        if ( ( b > 0 && a > limits::max() - b ) || ( b < 0 && a < limits::lowest() - b ) )
+            return false;
+
+        return fits<C>( a + b ) && fits<To>( a + b );
+    }
+
+    template< typename T >
+    static bool fits( W const y )
+    {
+        return y <= W( std::numeric_limits<T>::max() ) &&
+            ( !std::numeric_limits<T>::is_signed || !limits::is_signed || y >= W( std::numeric_limits<T>::lowest() ) );
+    }
+};
+
+/**
+ * converting a magnitude of type From with scale RFrom to type To with
+ * scale RTo is exact, i.e. it does not truncate, unless To is floating point.
+ */
+template< typename RFrom, typename From, typename RTo, typename To >
+struct is_exact_scaling : std::integral_constant< bool,
+    std::is_floating_point<To>::value ||
+    ( !std::is_floating_point<From>::value && std::ratio_divide<RFrom, RTo>::type::den == 1 ) > { };
+
+template< typename RFrom, typename From, typename RTo, typename To, typename R = void >
+using EnableIfExact = typename std::enable_if< is_exact_scaling<RFrom, From, RTo, To>::value, R >::type;
+
+template< typename RFrom, typename From, typename RTo, typename To, typename R = void >
+using EnableIfInexact = typename std::enable_if< !is_exact_scaling<RFrom, From, RTo, To>::value, R >::type;
+
+/**
+ * scaled quantity type, or the scaled number for a dimensionless result.
+ */
+template< typename D, typename R, typename T >
+struct scaled_collapse
+{
+    typedef scaled_quantity< D, R, T > type;
+
+    static constexpr type make( T const x ) { return type( magnitude_tag, x ); }
+};
+
+template< typename R, typename T >
+struct scaled_collapse< dimensionless_d, R, T >
+{
+    typedef T type;
+
+    static constexpr type make( T const x ) { return scale<R, T>( x ); }
+};
+
+template< typename DX, typename DY, typename RX, typename RY, typename X, typename Y >
+using ScaledProduct = scaled_collapse<
+    ProductDims<DX, DY>, std::ratio_multiply<RX, RY>, PromoteMul<X, Y> >;
+
+template< typename DX, typename DY, typename RX, typename RY, typename X, typename Y >
+using ScaledQuotient = scaled_collapse<
+    QuotientDims<DX, DY>, std::ratio_divide<RX, RY>, PromoteMul<X, Y> >;
+
+} // namespace detail
+
+/**
+ * \brief class "scaled_quantity" holds a magnitude in units of Ratio times
+ * the coherent SI unit of Dims, e.g. Ratio std::nano for nanoseconds.
+ */
+template< typename Dims, typename Ratio, typename T /*= Rep */ >
+class scaled_quantity
+{
+public:
+    typedef scaled_quantity<Dims, Ratio, T> this_type;
+
+    typedef Dims dimension_type;
+
+    typedef typename Ratio::type ratio_type;
+
+    typedef T value_type;
+
+    /**
+     * magnitude type of the quantity in SI units; Rep if T cannot
+     * represent it exactly, e.g. for integer nanoseconds.
+     */
+    typedef typename std::conditional<
+        detail::is_exact_scaling< Ratio, T, std::ratio<1>, T >::value, T, Rep >::type si_value_type;
+
+    /**
+     * default constructor, the magnitude is zero.
+     */
+    constexpr scaled_quantity() : m_value() { }
+
+    /**
+     * initializing constructor from a magnitude in units of Ratio.
+     */
+    template< typename X >
+    constexpr explicit scaled_quantity( detail::magnitude_tag_t, X x )
+    : m_value( x ) { }
+
+    /**
+     * converting constructor from a quantity in SI units,
+     * e.g. scaled_quantity<length_d, std::micro> x = 3 * meter;
+     * explicit if it truncates, e.g. from a double to an integer magnitude.
+     */
+    template< typename X, typename = detail::EnableIfExact< std::ratio<1>, X, Ratio, T > >
+    constexpr scaled_quantity( quantity<Dims, X> const & x )
+    : m_value( from_si( x ) ) { }
+
+    template< typename X, typename = detail::EnableIfInexact< std::ratio<1>, X, Ratio, T >, typename = void >
+    constexpr explicit scaled_quantity( quantity<Dims, X> const & x )
+    : m_value( from_si( x ) ) { }
+
+    /**
+     * converting constructor from another scale; the scale factor is a
+     * compile-time constant and is absent when the scales are equal.
+     * explicit if it truncates, e.g. from nanoseconds to integer microseconds.
+     */
+    template< typename R, typename X, typename = detail::EnableIfExact< R, X, Ratio, T > >
+    constexpr scaled_quantity( scaled_quantity<Dims, R, X> const & x )
+    : m_value( detail::scale< std::ratio_divide<R, Ratio>, T >( x.magnitude() ) ) { }
+
+    template< typename R, typename X, typename = detail::EnableIfInexact< R, X, Ratio, T >, typename = void >
+    constexpr explicit scaled_quantity( scaled_quantity<Dims, R, X> const & x )
+    : m_value( detail::scale< std::ratio_divide<R, Ratio>, T >( x.magnitude() ) ) { }
+
+    /**
+     * the quantity in SI units.
+     */
+    constexpr quantity<Dims, si_value_type> to_quantity() const
+    {
+        return quantity<Dims, si_value_type>( detail::magnitude_tag, detail::scale<Ratio, si_value_type>( m_value ) );
+    }
+
+    /**
+     * conversion to a quantity in SI units.
+     */
+    constexpr operator quantity<Dims, si_value_type>() const { return to_quantity(); }
+
+    /**
+     * the magnitude in units of Ratio.
+     */
+    constexpr value_type magnitude() const { return m_value; }
+
+    /**
+     * the quantity's dimensions.
+     */
+    constexpr dimension_type dimension() const { return dimension_type{}; }
+
+    /**
+     * zero of this scaled quantity type.
+     */
+    static constexpr scaled_quantity zero() { return scaled_quantity( detail::magnitude_tag, value_type( 0 ) ); }
+
+    // arithmetic on the magnitude in units of Ratio.
+
+    scaled_quantity & operator+=( scaled_quantity const & y ) { m_value += y.m_value; return *this; }
+    scaled_quantity & operator-=( scaled_quantity const & y ) { m_value -= y.m_value; return *this; }
+
+    template< typename Y >
+    detail::EnableIfScalar<Y, scaled_quantity &> operator*=( Y const & y ) { m_value *= detail::PromoteMul<T, Y>( y ); return *this; }
+
+    template< typename Y >
+    detail::EnableIfScalar<Y, scaled_quantity &> operator/=( Y const & y ) { m_value /= detail::PromoteMul<T, Y>( y ); return *this; }
+
+private:
+    template< typename X >
+    static constexpr T from_si( quantity<Dims, X> const & x )
+    {
+        return detail::scale< std::ratio_divide< std::ratio<1>, Ratio >, T >( x.magnitude() );
+    }
+
+private:
+    value_type m_value;
+
+    static_assert( ! Dims::is_all_zero, "scaled_quantity dimensions must not all be zero" );
+};
+
+// Arithmetic; operands of the same scale.
+
+/// + scaled_quantity
+
+template< typename D, typename R, typename X >
+constexpr scaled_quantity<D, R, X>
+operator+( scaled_quantity<D, R, X> const & x )
+{
+    return x;
+}
+
+/// - scaled_quantity
+
+template< typename D, typename R, typename X >
+constexpr scaled_quantity<D, R, X>
+operator-( scaled_quantity<D, R, X> const & x )
+{
+    return scaled_quantity<D, R, X>( detail::magnitude_tag, -x.magnitude() );
+}
+
+/// scaled_quantity + scaled_quantity
+
+template< typename D, typename R, typename X, typename Y >
+constexpr scaled_quantity<D, R, detail::PromoteAdd<X, Y>>
+operator+( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    typedef detail::PromoteAdd<X, Y> T;
+
+    return scaled_quantity<D, R, T>( detail::magnitude_tag, T( x.magnitude() ) + T( y.magnitude() ) );
+}
+
+/// scaled_quantity - scaled_quantity
+
+template< typename D, typename R, typename X, typename Y >
+constexpr scaled_quantity<D, R, detail::PromoteAdd<X, Y>>
+operator-( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    typedef detail::PromoteAdd<X, Y> T;
+
+    return scaled_quantity<D, R, T>( detail::magnitude_tag, T( x.magnitude() ) - T( y.magnitude() ) );
+}
+
+/// scaled_quantity * number
+
+template< typename D, typename R, typename X, typename Y >
+constexpr detail::EnableIfScalar<Y, scaled_quantity<D, R, detail::PromoteMul<X, Y>>>
+operator*( scaled_quantity<D, R, X> const & x, Y const & y )
+{
+    typedef detail::PromoteMul<X, Y> T;
+
+    return scaled_quantity<D, R, T>( detail::magnitude_tag, T( x.magnitude() ) * T( y ) );
+}
+
+/// number * scaled_quantity
+
+template< typename D, typename R, typename X, typename Y >
+constexpr detail::EnableIfScalar<X, scaled_quantity<D, R, detail::PromoteMul<Y, X>>>
+operator*( X const & x, scaled_quantity<D, R, Y> const & y )
+{
+    typedef detail::PromoteMul<Y, X> T;
+
+    return scaled_quantity<D, R, T>( detail::magnitude_tag, T( x ) * T( y.magnitude() ) );
+}
+
+/// scaled_quantity / number
+
+template< typename D, typename R, typename X, typename Y >
+constexpr detail::EnableIfScalar<Y, scaled_quantity<D, R, detail::PromoteMul<X, Y>>>
+operator/( scaled_quantity<D, R, X> const & x, Y const & y )
+{
+    typedef detail::PromoteMul<X, Y> T;
+
+    return scaled_quantity<D, R, T>( detail::magnitude_tag, T( x.magnitude() ) / T( y ) );
+}
+
+/// scaled_quantity * scaled_quantity, the scales multiply
+
+template< typename DX, typename DY, typename RX, typename RY, typename X, typename Y >
+constexpr typename detail::ScaledProduct<DX, DY, RX, RY, X, Y>::type
+operator*( scaled_quantity<DX, RX, X> const & x, scaled_quantity<DY, RY, Y> const & y )
+{
+    return detail::ScaledProduct<DX, DY, RX, RY, X, Y>::make( x.magnitude() * y.magnitude() );
+}
+
+/// scaled_quantity / scaled_quantity, the scales divide
+
+template< typename DX, typename DY, typename RX, typename RY, typename X, typename Y >
+constexpr typename detail::ScaledQuotient<DX, DY, RX, RY, X, Y>::type
+operator/( scaled_quantity<DX, RX, X> const & x, scaled_quantity<DY, RY, Y> const & y )
+{
+    return detail::ScaledQuotient<DX, DY, RX, RY, X, Y>::make( x.magnitude() / y.magnitude() );
+}
+
+// Comparison; operands of the same scale.
+
+template< typename D, typename R, typename X, typename Y >
+constexpr bool operator==( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    return x.magnitude() == y.magnitude();
+}
+
+template< typename D, typename R, typename X, typename Y >
+constexpr bool operator!=( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    return x.magnitude() != y.magnitude();
+}
+
+template< typename D, typename R, typename X, typename Y >
+constexpr bool operator<( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    return x.magnitude() < y.magnitude();
+}
+
+template< typename D, typename R, typename X, typename Y >
+constexpr bool operator<=( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    return x.magnitude() <= y.magnitude();
+}
+
+template< typename D, typename R, typename X, typename Y >
+constexpr bool operator>( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    return x.magnitude() > y.magnitude();
+}
+
+template< typename D, typename R, typename X, typename Y >
+constexpr bool operator>=( scaled_quantity<D, R, X> const & x, scaled_quantity<D, R, Y> const & y )
+{
+    return x.magnitude() >= y.magnitude();
+}
+
+/**
+ * convert to the scale of ToScaled, e.g.
+ * scale_cast< scaled_quantity<length_d, std::milli> >( x ).
+ */
+template< typename ToScaled, typename D, typename R, typename X >
+constexpr ToScaled scale_cast( scaled_quantity<D, R, X> const & x )
+{
+    return ToScaled( x );
+}
+
+/**
+ * convert to the scale of ToScaled like scale_cast(), but throw
+ * std::overflow_error if the magnitude does not fit in its value_type.
+ */
+template< typename ToScaled, typename D, typename R, typename X >
+ToScaled checked_scale_cast( scaled_quantity<D, R, X> const & x )
+{
+    typedef typename ToScaled::value_type T;
+    typedef typename std::ratio_divide< R, typename ToScaled::ratio_type >::type F;
+    typedef typename detail::scale_type< T, X >::type C;
+
+    if ( std::numeric_limits<T>::is_specialized &&
+         !detail::scale_in_range< F, T, C >::apply( C( x.magnitude() ) ) )
+    {
+        throw std::overflow_error( "phys::units::checked_scale_cast: magnitude out of range" );
+    }
+
+    return ToScaled( x );
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_SCALED_QUANTITY_HPP_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,402 @@
+/**
+ * \file unit_system.hpp
+ *
+ * \brief   Quantities in a normalized unit system with compile-time base scales.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Simulation codes often normalize to a reference length, time, charge etc.
+ * to keep magnitudes near one, so that they can compute in float without
+ * underflow. A unit system is a type with a constexpr static member function
+ * per base dimension that gives the SI magnitude of its base unit; deriving
+ * from si_system supplies 1 for the bases it does not override, e.g.:
+ *
+ *   struct plasma_units : si_system
+ *   {
+ *       static constexpr Rep length() { return 5e-6;    }  // cell size
+ *       static constexpr Rep time()   { return 1.8e-14; }  // plasma period
+ *   };
+ *
+ * A system_quantity<System, Dims, T> holds its magnitude in the coherent
+ * units of System. Arithmetic within one system works on the magnitudes
+ * directly: the system is coherent, so products and quotients need no
+ * rescaling. Conversion to and from SI multiplies by a single compile-time
+ * constant, computed in at least Rep precision. Mixing systems, or mixing
+ * with quantity, requires a conversion.
+ */
+
+#ifndef PHYS_UNITS_UNIT_SYSTEM_HPP_INCLUDED
+#define PHYS_UNITS_UNIT_SYSTEM_HPP_INCLUDED
+
+#include "phys/units/quantity.hpp"
+
+#include <type_traits>
+
+/// namespace phys.
+
+namespace phys {
+
+/// namespace units.
+
+namespace units {
+
+/**
+ * the SI unit system, and the base of other unit systems:
+ * the SI magnitude of the base unit of each base dimension.
+ */
+struct si_system
+{
+    static constexpr Rep length()             { return 1; }
+    static constexpr Rep mass()               { return 1; }
+    static constexpr Rep time()               { return 1; }
+    static constexpr Rep current()            { return 1; }
+    static constexpr Rep temperature()        { return 1; }
+    static constexpr Rep amount()             { return 1; }
+    static constexpr Rep luminous_intensity() { return 1; }
+};
+
+/*
+ * declare now, define later.
+ */
+template< typename System, typename Dims, typename T = Rep >
+class system_quantity;
+
+/// namespace detail.
+
+namespace detail {
+
+/**
+ * the system_quantity types are quantities.
+ */
+template< typename S, typename D, typename T >
+struct is_quantity_kind< system_quantity<S, D, T> > : std::true_type { };
+
+/**
+ * x to the integer power n.
+ */
+template< typename X >
+constexpr X signed_power( X const x, int const n )
+{
+    return n < 0 ? X( 1 ) / integral_power( x, unsigned( -n ) ) : integral_power( x, unsigned( n ) );
+}
+
+/**
+ * SI magnitude of the coherent unit of dimensions D in System.
+ */
+template< typename System, typename D >
+constexpr Rep system_scale()
+{
+    return signed_power( System::length()            , D::dim1 )
+         * signed_power( System::mass()              , D::dim2 )
+         * signed_power( System::time()              , D::dim3 )
+         * signed_power( System::current()           , D::dim4 )
+         * signed_power( System::temperature()       , D::dim5 )
+         * signed_power( System::amount()            , D::dim6 )
+         * signed_power( System::luminous_intensity(), D::dim7 );
+}
+
+/**
+ * system quantity type, or the plain number for a dimensionless result;
+ * a dimensionless magnitude is the same in every unit system.
+ */
+template< typename S, typename D, typename T >
+struct system_collapse
+{
+    typedef system_quantity< S, D, T > type;
+
+    static constexpr type make( T const x ) { return type( magnitude_tag, x ); }
+};
+
+template< typename S, typename T >
+struct system_collapse< S, dimensionless_d, T >
+{
+    typedef T type;
+
+    static constexpr type make( T const x ) { return x; }
+};
+
+template< typename S, typename DX, typename DY, typename X, typename Y >
+using SystemProduct = system_collapse< S,
+    ProductDims<DX, DY>, PromoteMul<X, Y> >;
+
+template< typename S, typename DX, typename DY, typename X, typename Y >
+using SystemQuotient = system_collapse< S,
+    QuotientDims<DX, DY>, PromoteMul<X, Y> >;
+
+} // namespace detail
+
+/**
+ * \brief class "system_quantity" holds a magnitude in the coherent unit of
+ * Dims in unit System, e.g. in cell sizes per plasma period for a speed.
+ */
+template< typename System, typename Dims, typename T /*= Rep */ >
+class system_quantity
+{
+public:
+    typedef system_quantity<System, Dims, T> this_type;
+
+    typedef System system_type;
+
+    typedef Dims dimension_type;
+
+    typedef T value_type;
+
+    /**
+     * magnitude type of the quantity in SI units; at least Rep, as SI
+     * magnitudes may be out of range of a normalized float.
+     */
+    typedef typename std::common_type<T, Rep>::type si_value_type;
+
+    /**
+     * default constructor, the magnitude is zero.
+     */
+    constexpr system_quantity() : m_value() { }
+
+    /**
+     * initializing constructor from a magnitude in units of System.
+     */
+    template< typename X >
+    constexpr explicit system_quantity( detail::magnitude_tag_t, X x )
+    : m_value( x ) { }
+
+    /**
+     * converting constructor from a quantity in SI units,
+     * e.g. system_quantity<plasma_units, length_d, float> x = 3 * micro * meter;
+     */
+    template< typename X >
+    constexpr system_quantity( quantity<Dims, X> const & x )
+    : m_value( T( si_value_type( x.magnitude() ) / scale() ) ) { }
+
+    /**
+     * SI magnitude of the unit of this quantity, a compile-time constant.
+     */
+    static constexpr si_value_type scale() { return si_value_type( detail::system_scale<System, Dims>() ); }
+
+    /**
+     * the quantity in SI units.
+     */
+    constexpr quantity<Dims, si_value_type> to_quantity() const
+    {
+        return quantity<Dims, si_value_type>( detail::magnitude_tag, si_value_type( m_value ) * scale() );
+    }
+
+    /**
+     * conversion to a quantity in SI units.
+     */
+    constexpr operator quantity<Dims, si_value_type>() const { return to_quantity(); }
+
+    /**
+     * the magnitude in units of System.
+     */
+    constexpr value_type magnitude() const { return m_value; }
+
+    /**
+     * the quantity's dimensions.
+     */
+    constexpr dimension_type dimension() const { return dimension_type{}; }
+
+    /**
+     * the unit of this quantity in System, i.e. magnitude one.
+     */
+    static constexpr system_quantity unit() { return system_quantity( detail::magnitude_tag, value_type( 1 ) ); }
+
+    /**
+     * zero of this system quantity type.
+     */
+    static constexpr system_quantity zero() { return system_quantity( detail::magnitude_tag, value_type( 0 ) ); }
+
+    // arithmetic on the magnitude in units of System.
+
+    system_quantity & operator+=( system_quantity const & y ) { m_value += y.m_value; return *this; }
+    system_quantity & operator-=( system_quantity const & y ) { m_value -= y.m_value; return *this; }
+
+    template< typename Y >
+    detail::EnableIfScalar<Y, system_quantity &> operator*=( Y const & y ) { m_value *= detail::PromoteMul<T, Y>( y ); return *this; }
+
+    template< typename Y >
+    detail::EnableIfScalar<Y, system_quantity &> operator/=( Y const & y ) { m_value /= detail::PromoteMul<T, Y>( y ); return *this; }
+
+private:
+    value_type m_value;
+
+    static_assert( ! Dims::is_all_zero, "system_quantity dimensions must not all be zero" );
+};
+
+/**
+ * the SI quantity q in unit System, e.g. in_system<plasma_units, float>( 3 * micro * meter ).
+ */
+template< typename System, typename T = Rep, typename D, typename X >
+constexpr system_quantity<System, D, T> in_system( quantity<D, X> const & q )
+{
+    return system_quantity<System, D, T>( q );
+}
+
+/**
+ * convert to another unit system; one multiplication by a compile-time constant.
+ */
+template< typename ToSystem, typename T, typename S, typename D, typename X >
+constexpr system_quantity<ToSystem, D, T> system_cast( system_quantity<S, D, X> const & x )
+{
+    typedef typename std::common_type<T, X, Rep>::type C;
+
+    return system_quantity<ToSystem, D, T>( detail::magnitude_tag,
+        T( C( x.magnitude() ) * C( detail::system_scale<S, D>() / detail::system_scale<ToSystem, D>() ) ) );
+}
+
+template< typename ToSystem, typename S, typename D, typename X >
+constexpr system_quantity<ToSystem, D, X> system_cast( system_quantity<S, D, X> const & x )
+{
+    return system_cast<ToSystem, X>( x );
+}
+
+// Arithmetic; operands of the same unit system.
+
+/// + system_quantity
+
+template< typename S, typename D, typename X >
+constexpr system_quantity<S, D, X>
+operator+( system_quantity<S, D, X> const & x )
+{
+    return x;
+}
+
+/// - system_quantity
+
+template< typename S, typename D, typename X >
+constexpr system_quantity<S, D, X>
+operator-( system_quantity<S, D, X> const & x )
+{
+    return system_quantity<S, D, X>( detail::magnitude_tag, -x.magnitude() );
+}
+
+/// system_quantity + system_quantity
+
+template< typename S, typename D, typename X, typename Y >
+constexpr system_quantity<S, D, detail::PromoteAdd<X, Y>>
+operator+( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    typedef detail::PromoteAdd<X, Y> T;
+
+    return system_quantity<S, D, T>( detail::magnitude_tag, T( x.magnitude() ) + T( y.magnitude() ) );
+}
+
+/// system_quantity - system_quantity
+
+template< typename S, typename D, typename X, typename Y >
+constexpr system_quantity<S, D, detail::PromoteAdd<X, Y>>
+operator-( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    typedef detail::PromoteAdd<X, Y> T;
+
+    return system_quantity<S, D, T>( detail::magnitude_tag, T( x.magnitude() ) - T( y.magnitude() ) );
+}
+
+/// system_quantity * number
+
+template< typename S, typename D, typename X, typename Y >
+constexpr detail::EnableIfScalar<Y, system_quantity<S, D, detail::PromoteMul<X, Y>>>
+operator*( system_quantity<S, D, X> const & x, Y const & y )
+{
+    typedef detail::PromoteMul<X, Y> T;
+
+    return system_quantity<S, D, T>( detail::magnitude_tag, T( x.magnitude() ) * T( y ) );
+}
+
+/// number * system_quantity
+
+template< typename S, typename D, typename X, typename Y >
+constexpr detail::EnableIfScalar<X, system_quantity<S, D, detail::PromoteMul<Y, X>>>
+operator*( X const & x, system_quantity<S, D, Y> const & y )
+{
+    typedef detail::PromoteMul<Y, X> T;
+
+    return system_quantity<S, D, T>( detail::magnitude_tag, T( x ) * T( y.magnitude() ) );
+}
+
+/// system_quantity / number
+
+template< typename S, typename D, typename X, typename Y >
+constexpr detail::EnableIfScalar<Y, system_quantity<S, D, detail::PromoteMul<X, Y>>>
+operator/( system_quantity<S, D, X> const & x, Y const & y )
+{
+    typedef detail::PromoteMul<X, Y> T;
+
+    return system_quantity<S, D, T>( detail::magnitude_tag, T( x.magnitude() ) / T( y ) );
+}
+
+/// system_quantity * system_quantity, no rescaling in a coherent system
+
+template< typename S, typename DX, typename DY, typename X, typename Y >
+constexpr typename detail::SystemProduct<S, DX, DY, X, Y>::type
+operator*( system_quantity<S, DX, X> const & x, system_quantity<S, DY, Y> const & y )
+{
+    typedef detail::PromoteMul<X, Y> T;
+
+    return detail::SystemProduct<S, DX, DY, X, Y>::make( T( x.magnitude() ) * T( y.magnitude() ) );
+}
+
+/// system_quantity / system_quantity, no rescaling in a coherent system
+
+template< typename S, typename DX, typename DY, typename X, typename Y >
+constexpr typename detail::SystemQuotient<S, DX, DY, X, Y>::type
+operator/( system_quantity<S, DX, X> const & x, system_quantity<S, DY, Y> const & y )
+{
+    typedef detail::PromoteMul<X, Y> T;
+
+    return detail::SystemQuotient<S, DX, DY, X, Y>::make( T( x.magnitude() ) / T( y.magnitude() ) );
+}
+
+// Comparison; operands of the same unit system.
+
+template< typename S, typename D, typename X, typename Y >
+constexpr bool operator==( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    return x.magnitude() == y.magnitude();
+}
+
+template< typename S, typename D, typename X, typename Y >
+constexpr bool operator!=( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    return x.magnitude() != y.magnitude();
+}
+
+template< typename S, typename D, typename X, typename Y >
+constexpr bool operator<( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    return x.magnitude() < y.magnitude();
+}
+
+template< typename S, typename D, typename X, typename Y >
+constexpr bool operator<=( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    return x.magnitude() <= y.magnitude();
+}
+
+template< typename S, typename D, typename X, typename Y >
+constexpr bool operator>( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    return x.magnitude() > y.magnitude();
+}
+
+template< typename S, typename D, typename X, typename Y >
+constexpr bool operator>=( system_quantity<S, D, X> const & x, system_quantity<S, D, Y> const & y )
+{
+    return x.magnitude() >= y.magnitude();
+}
+
+}} // namespace phys::units
+
+#endif // PHYS_UNITS_UNIT_SYSTEM_HPP_INCLUDED
+
+/*
+ * end of file
+ */
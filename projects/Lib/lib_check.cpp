@@ -0,0 +1,70 @@
+//
+// lib_check.cpp - print quantities of many dimensions, header-only or via the IO library
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// 'make check' in projects/gcc/Lib builds this program once header-only and
+// once with -DPHYS_UNITS_IO_LIBRARY against libphys-units-io.a, and compares
+// the output of both; 'make time_lib' compares their compile time and size.
+
+#include <iostream>
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/io.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+template< typename D >
+void print( quantity<D> const & q )
+{
+    std::cout << io::to_string( q ) << " | " << io::eng::to_string( q ) << " | " << to_unit_name( q ) << "\n";
+
+    char buf[ 64 ];
+    io::to_chars_result const r = io::to_chars( buf, buf + sizeof buf, q / 3, io::chars_format::shortest );
+    std::cout << std::string( buf, r.ptr ) << " | ";
+
+    { using namespace io;      std::cout << q << " | "; }
+    { using namespace io::eng; std::cout << q << "\n"; }
+}
+
+int main()
+{
+    print( 42.195_km );
+    print( 75_kg );
+    print( 9.58_s );
+    print( 16_A );
+    print( 293.15_K );
+    print( 2.5_mol );
+    print( 800_cd );
+    print( 9.81 * meter / square( second ) );
+    print( 2 * square( meter ) );
+    print( 4.7_uF );
+    print( 0.5_C );
+    print( 12_kJ );
+    print( 1.2_kN );
+    print( 50_Hz );
+    print( 230_V );
+    print( 4.7_kOhm );
+    print( 2.2_mH );
+    print( 1.5_T );
+    print( 0.3_Wb );
+    print( 101.325_kPa );
+    print( 2_kW );
+    print( 500_lx );
+    print( 10_mS );
+    print( 3_mSv );
+    print( 1000 * kilogram / cube( meter ) );
+    print( 120_km / hour );
+    print( 0.6 * watt / meter / kelvin );
+    print( 8.314 * joule / mole / kelvin );
+    print( 1.2e-6 * henry / meter );
+    print( 3 * cube( meter ) / second );
+
+    std::cout << prefix( "k" ) << " " << to_engineering_string( 0.00123, 3, false, true, "m" ) << "\n";
+}
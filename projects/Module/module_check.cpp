@@ -0,0 +1,80 @@
+//
+// module_check.cpp - the same computations via the headers and via import phys.units
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// 'make check' in projects/gcc/Module builds this program once with the
+// headers and once with -DMODULE_CHECK_IMPORT against the phys.units module,
+// and compares the output of both. The program prints with printf, as g++ 12
+// fails on standard library headers included next to an import of a module
+// that uses them.
+
+#include <cstdio>
+
+#ifdef MODULE_CHECK_IMPORT
+import phys.units;
+#else
+# include "phys/units/quantity.hpp"
+# include "phys/units/io.hpp"
+# include "phys/units/other_units.hpp"
+# include "phys/units/physical_constants.hpp"
+#endif
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+template< typename D, typename X >
+void print( char const * const text, quantity<D, X> const & q )
+{
+    std::printf( "%-24s %.17g [%d %d %d %d %d %d %d]\n", text, double( q.magnitude() ),
+        D::dim1, D::dim2, D::dim3, D::dim4, D::dim5, D::dim6, D::dim7 );
+}
+
+void print( char const * const text, double const x )
+{
+    std::printf( "%-24s %.17g\n", text, x );
+}
+
+constexpr quantity<energy_d> kinetic_energy( quantity<mass_d> const m, quantity<speed_d> const v )
+{
+    return m * v * v / 2;
+}
+
+int main()
+{
+    constexpr quantity<speed_d> v = 3 * meter / ( 2 * second ) + 1_m / 1_s;
+
+    print( "speed", v );
+    print( "kinetic energy", kinetic_energy( 2_kg, v ) );
+    print( "sqrt(v*v)", sqrt( v * v ) );
+    print( "nth_root<3>(v^3)", nth_root<3>( cube( v ) ) );
+    print( "nth_power<-2>(v)", nth_power<-2>( v ) );
+    print( "abs(-v)", abs( -v ) );
+    print( "literal", 1.5_km );
+    print( "prefixes", 3_km + 250 * milli * kilo * meter );
+    print( "derived units", volt * ampere * second / joule );
+    print( "percent", percent * 50 );
+    print( "foot / inch", foot / inch );
+    print( "mile per hour", mile / hour );
+    print( "barrel", barrel );
+    print( "c * u", c * u );
+    print( "h / e", h / e );
+    print( "eV / joule", eV / joule );
+    print( "compare", ( v < 3 * meter / second ) + 2 * ( v == v ) );
+
+    std::printf( "%s\n", io::to_string( v ).c_str() );
+    std::printf( "%s\n", io::eng::to_string( 3.3 * micro * farad ).c_str() );
+    std::printf( "%s\n", to_engineering_string( 1234.5, 3, false, true, "x+y" ).c_str() );
+    std::printf( "%s\n", to_unit_symbol( c * u ).c_str() );
+
+    char buf[ 64 ];
+    io::to_chars_result const r = io::to_chars( buf, buf + sizeof buf, v / 3, io::chars_format::shortest );
+    std::printf( "%.*s\n", int( r.ptr - buf ), buf );
+}
+
+// g++ -std=c++20 -I../../ -o module_check.exe module_check.cpp
@@ -34,6 +34,10 @@ using namespace phys::units::literals;
 
 const int mag = 123;
 
+// With PHYS_UNITS_ERASED, a quantity is a plain number: the tests that use
+// members of quantity are left out, and the others check the numbers only,
+// without unit symbols (see s() in test_util.hpp).
+
 #ifdef TEST_COMPILE_TIME
 
 const lest::test compile_time[] =
@@ -58,12 +62,43 @@ const lest::test compile_time[] =
         quantity<mass_d  > mass( detail::magnitude_tag, mag );
         quantity<length_d> length( mass );
     },
+
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+    "packed dimension exponents must be in [-128, 127], also as written", []
+    {
+        typedef dimensions< 200, 0, 0 > m200_d;
+        typedef dimensions< 0, 0, -129 > s129_d;
+        auto const m128 = nth_power<128>( meter );
+    },
+#endif
 };
 
 #else // TEST_COMPILE_TIME
 
 const lest::test construction[] =
 {
+    "dimensions keep their exponents, also when packed", []
+    {
+        typedef dimensions< 1, -2, 3, -128, 127, 0, -1 > D;
+
+        EXPECT( D::dim1 ==    1 );
+        EXPECT( D::dim2 ==   -2 );
+        EXPECT( D::dim3 ==    3 );
+        EXPECT( D::dim4 == -128 );
+        EXPECT( D::dim5 ==  127 );
+        EXPECT( D::dim6 ==    0 );
+        EXPECT( D::dim7 ==   -1 );
+        EXPECT( ( std::is_same< decltype( meter / second ), quantity< dimensions< 1, 0, -1 > > >::value ) );
+        EXPECT( ( std::is_same< decltype( meter / meter ), Rep >::value ) );
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+        EXPECT( ( std::is_same< dimensions< 1, 0, -1 >, packed_dimensions< 1 - 256 * 256 > >::value ) );
+        EXPECT( ( dimensions< 127, -128, 0, 0, 0, 0, 127 >::dim1 ==  127 ) );
+        EXPECT( ( dimensions< 127, -128, 0, 0, 0, 0, 127 >::dim2 == -128 ) );
+        EXPECT( ( dimensions< 127, -128, 0, 0, 0, 0, 127 >::dim7 ==  127 ) );
+#endif
+    },
+
+#ifndef PHYS_UNITS_ERASED
     "quantity can be magnitude-constructed", []
     {
         quantity<mass_d, int> mass( detail::magnitude_tag, mag );
@@ -113,6 +148,7 @@ const lest::test construction[] =
         EXPECT( mass2.magnitude() == mass1.magnitude() );
         EXPECT( mass2.dimension() == mass1.dimension() );
     },
+#endif // PHYS_UNITS_ERASED
 };
 
 quantity<area_d> a1;
@@ -325,7 +361,9 @@ const lest::test functions[] =
     {
         constexpr quantity<length_d, int> length = 2 * meter;
 
+#ifndef PHYS_UNITS_ERASED
         EXPECT( dimension( length ) == length_d{} );
+#endif
         EXPECT( magnitude( length ) == 2          );
     },
 
@@ -378,6 +416,23 @@ const lest::test functions[] =
         EXPECT( s( sqrt( freq * thing ) ) == "15.000000 s-1 A" );
     },
 
+    "quantity powers are compile-time, roots exact for perfect powers", []
+    {
+        constexpr quantity<length_d> x = 2 * meter;
+
+        static_assert( magnitude( nth_power< 5>( x ) ) == 32,   "" );
+        static_assert( magnitude( nth_power<-2>( x ) ) == 0.25, "" );
+        static_assert( nth_power< 0>( x ) == 1,                 "" );
+
+        EXPECT( magnitude( nth_power<7>( 1.5 * meter ) ) == 1.5 * 1.5 * 1.5 * 1.5 * 1.5 * 1.5 * 1.5 );
+
+        EXPECT( nth_root<3>( 27 * cube( meter ) ) == 3 * meter );
+        EXPECT( nth_root<4>( 81 * nth_power<4>( meter ) ) == 3 * meter );
+        EXPECT( nth_root<6>( 64 * nth_power<6>( meter ) ) == 2 * meter );
+        EXPECT( nth_root<3>( -8 * cube( meter ) ) == -2 * meter );
+        EXPECT( magnitude( sqrt( 2 * square( meter ) ) ) == std::sqrt( 2.0 ) );
+    },
+
     "quantity, various functions", []
     {
         quantity<length_d> m( meter );
@@ -387,6 +442,24 @@ const lest::test functions[] =
         EXPECT( s( abs( -m ) ) == "1.000000 m" );
     },
 
+#ifndef PHYS_UNITS_ERASED
+    "quantity with integer magnitude, exact functions", []
+    {
+        typedef quantity<length_d, long> length_i;
+
+        length_i const x( detail::magnitude_tag, 3 );
+
+        EXPECT( ( quantity<length_d, long>::zero().magnitude() == 0 ) );
+        EXPECT( nth_power<3>( x ).magnitude() == 27 );
+        EXPECT( nth_power<0>( x ) == 1 );
+        EXPECT( nth_root<3>( nth_power<3>( x ) ) == x );
+        EXPECT( sqrt( x * x ) == x );
+        EXPECT( abs( -x ) == x );
+        EXPECT( ( x * 7 / 2 ).magnitude() == 10 );
+        EXPECT( ( std::is_same< decltype( x * 0.5 ), quantity<length_d, double> >::value ) );
+    },
+#endif // PHYS_UNITS_ERASED
+
     "quantity function exceptions", []
     {
     // dimension powers must be even mutiples:
@@ -440,6 +513,31 @@ const lest::test ud_literals[] =
 
     "cooked literals prefix variations", []
     {
+#ifdef PHYS_UNITS_ERASED
+        // output shows the magnitude only, without prefix and unit symbol:
+
+        EXPECT( 1._Ys == 1e+24 * second );
+        EXPECT( 1._Zs == 1e+21 * second );
+        EXPECT( 1._Es == 1e+18 * second );
+        EXPECT( 1._Ps == 1e+15 * second );
+        EXPECT( 1._Ts == 1e+12 * second );
+        EXPECT( 1._Gs == 1e+9  * second );
+        EXPECT( 1._Ms == 1e+6  * second );
+        EXPECT( 1._ks == 1e+3  * second );
+        EXPECT( 1._hs == 1e+2  * second );
+        EXPECT( 1._das== 1e+1  * second );
+        EXPECT( 1._s  == 1e+0  * second );
+        EXPECT( 1._ds == 1e-1  * second );
+        EXPECT( 1._cs == 1e-2  * second );
+        EXPECT( 1._ms == 1e-3  * second );
+        EXPECT( 1._us == 1e-6  * second );
+        EXPECT( 1._ns == 1e-9  * second );
+        EXPECT( 1._ps == 1e-12 * second );
+        EXPECT( 1._fs == 1e-15 * second );
+        EXPECT( 1._as == 1e-18 * second );
+        EXPECT( 1._zs == 1e-21 * second );
+        EXPECT( 1._ys == 1e-24 * second );
+#else
         using namespace phys::units::io::eng;
 
         EXPECT( to_string( 1._Ys ) == "1.00 Ys" );
@@ -463,6 +561,7 @@ const lest::test ud_literals[] =
         EXPECT( to_string( 1._as ) == "1.00 as" );
         EXPECT( to_string( 1._zs ) == "1.00 zs" );
         EXPECT( to_string( 1._ys ) == "1.00 ys" );
+#endif
     },
 
     "cooked literals defects", []
@@ -470,6 +569,29 @@ const lest::test ud_literals[] =
         // prefix smaller than 1 with integral type
         EXPECT( s( 20_mA ) == "0.020000 A" );
     },
+
+    "cooked literals yield Rep", []
+    {
+        EXPECT( ( std::is_same< decltype( 1.5_km ), quantity<length_d, Rep> >::value ) );
+        EXPECT( ( std::is_same< decltype( 20_mA  ), quantity<electric_current_d, Rep> >::value ) );
+        EXPECT( ( std::is_same< decltype( 1.00002_m * 2.0 ), quantity<length_d, Rep> >::value ) );
+
+        static_assert( magnitude( 1.5_km ) == 1500, "prefix is applied at compile time" );
+    },
+
+    "cooked float literals yield float", []
+    {
+        // literals and float_literals are alternatives, hence no using-directive here:
+
+        using literals::float_literals::operator"" _km;
+        using literals::float_literals::operator"" _mg;
+
+        EXPECT( ( std::is_same< decltype( 1.5_km ), quantity<length_d, float> >::value ) );
+        EXPECT( ( std::is_same< decltype( 2_mg   ), quantity<mass_d,   float> >::value ) );
+
+        EXPECT( magnitude( 1.5_km ) == 1500.0f );
+        EXPECT( magnitude( 1.5_km * 2.0f ) == 3000.0f );
+    },
 };
 
 const lest::test units[] =
@@ -486,6 +608,7 @@ const lest::test units[] =
         EXPECT( s( candela  ) == "1.000000 cd" );
     },
 
+#ifndef PHYS_UNITS_ERASED
     "the rest of the standard dimensional types, as specified in SP811", []
     {
         EXPECT( s( quantity< absorbed_dose_d >::zero() ) == "0.000000 m+2 s-2" );
@@ -555,6 +678,7 @@ const lest::test units[] =
         EXPECT( s( quantity< volume_flow_rate_d >::zero() ) == "0.000000 m+3 s-1" );
         EXPECT( s( quantity< wave_number_d >::zero() ) == "0.000000 m-1" );
     },
+#endif // PHYS_UNITS_ERASED
 
     "the derived SI units, as specified in SP811", []
     {
@@ -0,0 +1,178 @@
+/**
+ * \file test_quantity_accumulator.cpp
+ *
+ * \brief   lest tests for accurate summation of quantities.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_accumulator.hpp"
+#include "phys/units/quantity_array.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+#include <vector>
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+typedef quantity<energy_d, float> energy_f;
+
+energy_f joules_f( float const x )
+{
+    return energy_f( detail::magnitude_tag, x );
+}
+
+// a large total followed by many terms smaller than half its ulp in float:
+
+std::vector<energy_f> small_after_large()
+{
+    std::vector<energy_f> v( 1001, joules_f( 1.0f ) );
+    v[0] = joules_f( 1e8f );
+    return v;
+}
+
+const lest::test accumulator[] =
+{
+    "quantity_accumulator starts at zero", []
+    {
+        quantity_accumulator<energy_d, float> acc;
+
+        EXPECT( acc.count() == 0u );
+        EXPECT( acc.total().magnitude() == 0 );
+    },
+
+    "quantity_accumulator accumulates float in double by default", []
+    {
+        quantity_accumulator<energy_d, float> acc;
+
+        EXPECT( ( std::is_same< decltype( acc.total() ), quantity<energy_d, double> >::value ) );
+
+        auto const v = small_after_large();
+        acc.add( v.begin(), v.end() );
+
+        EXPECT( acc.count() == 1001u );
+        EXPECT( acc.total().magnitude() == 100001000.0 );
+    },
+
+    "plain float summation loses the small terms", []
+    {
+        auto const v = small_after_large();
+
+        energy_f sum = energy_f::zero();
+
+        for ( auto const & q : v ) { sum += q; }
+
+        EXPECT( sum.magnitude() == 1e8f );
+    },
+
+    "Kahan summation in float keeps the small terms", []
+    {
+        quantity_accumulator<energy_d, float, float, accumulation::kahan> acc;
+
+        auto const v = small_after_large();
+        acc.add( v.begin(), v.end() );
+
+        EXPECT( std::abs( acc.total().magnitude() - 100001000.0f ) <= 8.0f );
+    },
+
+    "Neumaier summation in float keeps the small terms", []
+    {
+        quantity_accumulator<energy_d, float, float, accumulation::neumaier> acc;
+
+        auto const v = small_after_large();
+        acc.add( v.begin(), v.end() );
+
+        EXPECT( std::abs( acc.total().magnitude() - 100001000.0f ) <= 8.0f );
+    },
+
+    "Neumaier summation is exact where Kahan summation is not", []
+    {
+        std::vector< quantity<energy_d> > const v{ 1 * joule, 1e100 * joule, 1 * joule, -1e100 * joule };
+
+        quantity_accumulator<energy_d, double, double, accumulation::kahan   > kahan;
+        quantity_accumulator<energy_d, double, double, accumulation::neumaier> neumaier;
+
+        kahan   .add( v.begin(), v.end() );
+        neumaier.add( v.begin(), v.end() );
+
+        EXPECT( kahan   .total() == 0 * joule );
+        EXPECT( neumaier.total() == 2 * joule );
+    },
+
+    "pairwise summation in float has a small error", []
+    {
+        quantity_accumulator<energy_d, float, float, accumulation::plain   > plain;
+        quantity_accumulator<energy_d, float, float, accumulation::pairwise> pairwise;
+
+        for ( int i = 0; i < 1000000; ++i )
+        {
+            plain    += joules_f( 0.1f );
+            pairwise += joules_f( 0.1f );
+        }
+
+        EXPECT( std::abs( plain   .total().magnitude() - 100000.0f ) >  100.0f );
+        EXPECT( std::abs( pairwise.total().magnitude() - 100000.0f ) <    1.0f );
+    },
+
+    "pairwise summation of a partial block", []
+    {
+        quantity_accumulator<energy_d, double, double, accumulation::pairwise> acc;
+
+        for ( int i = 0; i < 3 * PHYS_UNITS_PAIRWISE_BLOCK + 5; ++i )
+        {
+            acc += 2 * joule;
+        }
+
+        EXPECT( acc.total() == ( 6 * PHYS_UNITS_PAIRWISE_BLOCK + 10 ) * joule );
+    },
+
+    "quantity_accumulator can be reset", []
+    {
+        quantity_accumulator<energy_d> acc;
+
+        acc += 3 * joule;
+        acc.reset();
+
+        EXPECT( acc.count() == 0u );
+        EXPECT( acc.total() == 0 * joule );
+    },
+
+    "accumulate() sums a range", []
+    {
+        quantity_array<electric_charge_d, float> a( 1000, quantity<electric_charge_d, float>( detail::magnitude_tag, 0.1f ) );
+
+        auto const total = accumulate( a.begin(), a.end() );
+        auto const total_pairwise = accumulate<accumulation::pairwise>( a.begin(), a.end() );
+
+        EXPECT( ( std::is_same< decltype( total ), quantity<electric_charge_d, double> const >::value ) );
+        EXPECT( std::abs( total         .magnitude() - 100.0 ) < 1e-5 );
+        EXPECT( std::abs( total_pairwise.magnitude() - 100.0 ) < 1e-5 );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( accumulator )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_accumulator.exe test_quantity_accumulator.cpp && test_quantity_accumulator.exe
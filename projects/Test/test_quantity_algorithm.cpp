@@ -0,0 +1,164 @@
+/**
+ * \file test_quantity_algorithm.cpp
+ *
+ * \brief   lest tests for reductions over spans and arrays of quantities.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// use several threads for small ranges too:
+
+#define PHYS_UNITS_PARALLEL_GRAIN 16
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_algorithm.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+// 1, 2, ..., n meter:
+
+quantity_array<length_d> ramp( std::size_t const n )
+{
+    quantity_array<length_d> a( n );
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        a[i] = Rep( i + 1 ) * meter;
+    }
+    return a;
+}
+
+const lest::test reduction[] =
+{
+    "sum() of an empty range is zero", []
+    {
+        quantity_array<length_d> a;
+
+        EXPECT( sum( a ) == 0 * meter );
+    },
+
+    "sum() adds the elements, serial and in threads", []
+    {
+        auto const a = ramp( 1001 );
+
+        EXPECT( sum( a, 1 ) == 501501 * meter );
+        EXPECT( sum( a, 4 ) == 501501 * meter );
+        EXPECT( sum( a.span(), 3 ) == 501501 * meter );
+    },
+
+    "sum() of float accumulates in double", []
+    {
+        quantity_array<length_d, float> a( 100, quantity<length_d, float>( detail::magnitude_tag, 0.5f ) );
+
+        EXPECT( ( std::is_same< decltype( sum( a ) ), quantity<length_d, double> >::value ) );
+        EXPECT( sum( a ) == 50 * meter );
+    },
+
+    "sum() of an expression has the dimension of the expression", []
+    {
+        quantity_array<speed_d> v( 100, 2 * meter / second );
+
+        auto const x = sum( v * ( 3 * second ) );
+
+        EXPECT( ( std::is_same< decltype( x )::dimension_type, length_d >::value ) );
+        EXPECT( x == 600 * meter );
+    },
+
+    "mean() and rms() keep the dimension", []
+    {
+        auto const a = ramp( 3 );
+
+        EXPECT( ( std::is_same< decltype( mean( a ) )::dimension_type, length_d >::value ) );
+        EXPECT( ( std::is_same< decltype( rms ( a ) )::dimension_type, length_d >::value ) );
+
+        EXPECT( mean( a ) == 2 * meter );
+        EXPECT( s( rms( a ).magnitude() ) == s( std::sqrt( 14.0 / 3 ) ) );
+        EXPECT( mean( ramp( 999 ), 4 ) == 500 * meter );
+    },
+
+    "min() and max() find the extremes, serial and in threads", []
+    {
+        auto a = ramp( 1000 );
+
+        a[ 123 ] = -5 * meter;
+        a[ 877 ] = 5000 * meter;
+
+        EXPECT( min( a, 1 ) == -5 * meter );
+        EXPECT( max( a, 1 ) ==  5000 * meter );
+        EXPECT( min( a, 4 ) == -5 * meter );
+        EXPECT( max( a, 4 ) ==  5000 * meter );
+        EXPECT( max( -a ) == 5 * meter );
+    },
+
+    "min() and max() find the extremes with more threads than full chunks", []
+    {
+        // 641 elements in 40 threads: ceil(641/40) = 17 elements per
+        // chunk would leave the last chunks empty:
+
+        auto const a = ramp( 641 );
+
+        EXPECT( min( a, 40 ) ==   1 * meter );
+        EXPECT( max( a, 40 ) == 641 * meter );
+        EXPECT( sum( a, 40 ) == 205761 * meter );
+    },
+
+    "parallel reduction passes an exception of a thread to the caller", []
+    {
+        auto const add  = []( int x, int y ) { return x + y; };
+        auto const size = []( std::size_t first, std::size_t last ) { return int( last - first ); };
+        auto const fail_last  = []( std::size_t, std::size_t last  ) { return last  < 1000 ? 1 : throw std::runtime_error( "thread" ); };
+        auto const fail_first = []( std::size_t first, std::size_t ) { return first > 0    ? 1 : throw std::runtime_error( "caller" ); };
+
+        EXPECT( detail::parallel_reduce<int>( 1000, 4, size, add ) == 1000 );
+        EXPECT_THROWS_AS( detail::parallel_reduce<int>( 1000, 4, fail_last , add ), std::runtime_error );
+        EXPECT_THROWS_AS( detail::parallel_reduce<int>( 1000, 4, fail_first, add ), std::runtime_error );
+    },
+
+    "dot() multiplies the dimensions", []
+    {
+        quantity_array<force_d > f( 1000, 2 * newton );
+        quantity_array<length_d> x( 1000, 3 * meter );
+
+        auto const w = dot( f, x, 4 );
+
+        EXPECT( ( std::is_same< decltype( w ), quantity<energy_d> const >::value ) );
+        EXPECT( w == 6000 * joule );
+        EXPECT( dot( f, x, 1 ) == w );
+    },
+
+    "dot() of a dimensionless product is a number", []
+    {
+        auto const a = ramp( 3 );
+
+        EXPECT( ( std::is_same< decltype( dot( a, 1 / a ) ), Rep >::value ) );
+        EXPECT( dot( a, 1 / a ) == 3 );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( reduction )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -pthread -I../../ -o test_quantity_algorithm.exe test_quantity_algorithm.cpp && test_quantity_algorithm.exe
@@ -0,0 +1,159 @@
+/**
+ * \file test_quantity_allocator.cpp
+ *
+ * \brief   lest tests for uninitialized construction of quantities.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_allocator.hpp"
+#include "phys/units/quantity_array.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+#include <list>
+#include <vector>
+
+using namespace phys::units;
+
+typedef quantity<length_d> length;
+
+// allocator that counts the constructions with arguments:
+
+template< typename T >
+struct counting_allocator : std::allocator<T>
+{
+    typedef T value_type;
+
+    template< typename U > struct rebind { typedef counting_allocator<U> other; };
+
+    counting_allocator() = default;
+
+    template< typename U >
+    counting_allocator( counting_allocator<U> const & ) { }
+
+    template< typename U, typename... Args >
+    void construct( U * p, Args &&... args )
+    {
+        ++count;
+        ::new( static_cast<void *>( p ) ) U( std::forward<Args>( args )... );
+    }
+
+    static int count;
+};
+
+template< typename T >
+int counting_allocator<T>::count = 0;
+
+const lest::test no_init_construction[] =
+{
+    "quantity can be constructed uninitialized and assigned", []
+    {
+        length x( no_init );
+
+        x = 3 * meter;
+
+        EXPECT( x == 3 * meter );
+        EXPECT( length() == length::zero() );
+    },
+
+    "no_init_allocator sizes a vector that can be filled", []
+    {
+        std::vector< length, no_init_allocator<length> > v( 1000 );
+
+        for ( std::size_t i = 0; i < v.size(); ++i ) { v[i] = Rep( i ) * meter; }
+
+        EXPECT( v.size() == 1000u );
+        EXPECT( v[999] == 999 * meter );
+
+        v.resize( 2000 );
+
+        EXPECT( v.size() == 2000u );
+        EXPECT( v[999] == 999 * meter );
+    },
+
+    "no_init_allocator constructs with arguments as usual", []
+    {
+        std::vector< length, no_init_allocator<length> > v( 3, 2 * meter );
+
+        v.push_back( 5 * meter );
+        v.emplace_back( meter );
+
+        EXPECT( v[0] == 2 * meter );
+        EXPECT( v[2] == 2 * meter );
+        EXPECT( v[3] == 5 * meter );
+        EXPECT( v[4] == 1 * meter );
+
+        std::vector< int, no_init_allocator<int> > w( 2, 7 );
+
+        EXPECT( w[1] == 7 );
+    },
+
+    "no_init_allocator forwards construction with arguments to the allocator it adapts", []
+    {
+        typedef no_init_allocator< length, counting_allocator<length> > alloc;
+
+        counting_allocator<length>::count = 0;
+
+        std::vector< length, alloc > v;
+        v.reserve( 11 );
+        v.resize( 10 );
+
+        EXPECT( counting_allocator<length>::count == 0 );
+
+        v.push_back( meter );
+
+        EXPECT( counting_allocator<length>::count == 1 );
+    },
+
+    "no_init_allocator rebinds and compares as the allocator it adapts", []
+    {
+        std::list< length, no_init_allocator<length> > l( 2 );
+
+        l.front() = meter;
+
+        no_init_allocator<length> a;
+        no_init_allocator<int> b( a );
+
+        EXPECT( l.front() == meter );
+        EXPECT( ( a == b ) );
+        EXPECT( ( !( a != b ) ) );
+        EXPECT( ( std::is_same< std::allocator_traits< no_init_allocator<length> >::rebind_alloc<int>, no_init_allocator<int> >::value ) );
+    },
+
+    "quantity_array can be sized uninitialized", []
+    {
+        quantity_array<length_d> a( 100, no_init );
+
+        for ( auto & x : a ) { x = 2 * meter; }
+
+        EXPECT( a.size() == 100u );
+        EXPECT( a[99] == 2 * meter );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( no_init_construction )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_allocator.exe test_quantity_allocator.cpp && test_quantity_allocator.exe
@@ -0,0 +1,379 @@
+/**
+ * \file test_quantity_array.cpp
+ *
+ * \brief   lest tests for quantity arrays and spans.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_array.hpp"
+#include "phys/units/other_units.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+#include <vector>
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+const lest::test construction[] =
+{
+    "quantity_array can be default-constructed", []
+    {
+        quantity_array<length_d> a;
+
+        EXPECT( a.size() == 0u );
+        EXPECT( a.empty() );
+    },
+
+    "quantity_array can be size-constructed, elements are zero", []
+    {
+        quantity_array<length_d> a( 100 );
+
+        EXPECT( a.size() == 100u );
+        EXPECT( a[ 0] == quantity<length_d>::zero() );
+        EXPECT( a[99] == quantity<length_d>::zero() );
+    },
+
+    "quantity_array can be constructed from a value", []
+    {
+        quantity_array<length_d> a( 33, 2 * meter );
+
+        EXPECT( a.size() == 33u );
+        EXPECT( a[ 0] == 2 * meter );
+        EXPECT( a[32] == 2 * meter );
+    },
+
+    "quantity_array can be constructed from an initializer list", []
+    {
+        quantity_array<time_interval_d> a{ 1 * second, 2 * second, 3 * second };
+
+        EXPECT( a.size() == 3u );
+        EXPECT( a[2] == 3 * second );
+    },
+
+    "quantity_array can be copied and moved", []
+    {
+        quantity_array<length_d> a( 20, meter );
+        quantity_array<length_d> b( a );
+
+        EXPECT( b.size() == 20u );
+        EXPECT( b[19] == meter );
+        EXPECT( b.data() != a.data() );
+
+        quantity_array<length_d> c( std::move( a ) );
+
+        EXPECT( c.size() == 20u );
+        EXPECT( a.size() ==  0u );
+
+        a = c;
+
+        EXPECT( a.size() == 20u );
+        EXPECT( a[19] == meter );
+    },
+
+    "quantity_array storage is aligned", []
+    {
+        quantity_array<length_d> a( 3 );
+
+        EXPECT( ( reinterpret_cast<std::uintptr_t>( a.data() ) % PHYS_UNITS_ARRAY_ALIGNMENT ) == 0u );
+    },
+
+    "quantity_array of a size that overflows the allocation throws", []
+    {
+        EXPECT_THROWS_AS( quantity_array<length_d>( SIZE_MAX / 8 + 1 ).size(), std::bad_alloc );
+        EXPECT_THROWS_AS( quantity_array<length_d>( SIZE_MAX / 8 ).size(), std::bad_alloc );
+        EXPECT_THROWS_AS( quantity_array<length_d>( SIZE_MAX, no_init ).size(), std::bad_alloc );
+    },
+
+    "quantity_span views an array", []
+    {
+        quantity_array<length_d> a( 10, meter );
+
+        quantity_span<length_d>       s = a;
+        const_quantity_span<length_d> c = a;
+
+        EXPECT( s.size() == 10u );
+        EXPECT( c.data() == a.data() );
+
+        s[3] = 3 * meter;
+
+        EXPECT( a[3] == 3 * meter );
+        EXPECT( c.subspan( 3, 2 ).size() == 2u );
+        EXPECT( c.subspan( 3, 2 )[0] == 3 * meter );
+    },
+};
+
+const lest::test arithmetic[] =
+{
+    "quantity_array element-wise addition and subtraction", []
+    {
+        quantity_array<length_d> a( 37, 3 * meter );
+        quantity_array<length_d> b( 37, 2 * meter );
+
+        quantity_array<length_d> sum  = a + b;
+        quantity_array<length_d> diff = a - b.span();
+        quantity_array<length_d> neg  = -a;
+
+        EXPECT( sum.size() == 37u );
+        EXPECT( sum [36] == 5 * meter );
+        EXPECT( diff[36] == 1 * meter );
+        EXPECT( neg [36] == -3 * meter );
+    },
+
+    "quantity_array element-wise multiplication and division derive dimensions", []
+    {
+        quantity_array<speed_d        > v( 19, 4 * meter / second );
+        quantity_array<time_interval_d> t( 19, 2 * second );
+
+        quantity_array<length_d> x = v * t;
+        quantity_array<acceleration_d> a = v / t;
+
+        EXPECT( x[18] == 8 * meter );
+        EXPECT( a[18] == 2 * meter / square( second ) );
+    },
+
+    "quantity_array can be scaled by numbers and quantities", []
+    {
+        quantity_array<length_d> a( 17, 6 * meter );
+
+        quantity_array<length_d> b = a * 2;
+        quantity_array<length_d> c = 0.5 * a;
+        quantity_array<speed_d > v = a / ( 3 * second );
+        quantity_array<frequency_d> f = ( 12 * meter / second ) / a;
+
+        EXPECT( b[16] == 12 * meter );
+        EXPECT( c[16] ==  3 * meter );
+        EXPECT( v[16] ==  2 * meter / second );
+        EXPECT( f[16] ==  2 / second );
+    },
+
+    "quantity_array compound assignment", []
+    {
+        quantity_array<length_d> a( 21, 1 * meter );
+        quantity_array<length_d> b( 21, 2 * meter );
+
+        a += b;   EXPECT( a[20] == 3 * meter );
+        a -= b;   EXPECT( a[20] == 1 * meter );
+        a *= 8;   EXPECT( a[20] == 8 * meter );
+        a /= 4;   EXPECT( a[20] == 2 * meter );
+
+        a.span().subspan( 0, 1 ) += b.span().subspan( 0, 1 );
+
+        EXPECT( a[ 0] == 4 * meter );
+        EXPECT( a[20] == 2 * meter );
+    },
+};
+
+const lest::test expressions[] =
+{
+    "quantity_expression defers evaluation until assignment", []
+    {
+        quantity_array<length_d> a( 5, 1 * meter );
+        quantity_array<length_d> b( 5, 2 * meter );
+
+        auto e = a + b;
+
+        a[0] = 10 * meter;
+
+        EXPECT( e.size() == 5u );
+        EXPECT( e[0] == 12 * meter );
+        EXPECT( e[4] ==  3 * meter );
+    },
+
+    "quantity_expression fuses a kinematics update", []
+    {
+        const quantity<time_interval_d> dt = 2 * second;
+
+        quantity_array<length_d      > x0( 41, 1 * meter );
+        quantity_array<speed_d       > v ( 41, 3 * meter / second );
+        quantity_array<acceleration_d> a ( 41, 4 * meter / square( second ) );
+        quantity_array<length_d      > x;
+
+        x = x0 + v * dt + 0.5 * a * dt * dt;
+
+        EXPECT( x.size() == 41u );
+        EXPECT( x[ 0] == 15 * meter );
+        EXPECT( x[40] == 15 * meter );
+
+        x = x + v * dt;
+
+        EXPECT( x[40] == 21 * meter );
+    },
+
+    "quantity_expression combines with quantities", []
+    {
+        quantity_array<length_d> a( 3, 4 * meter );
+
+        quantity_array<length_d> b = a - 1 * meter;
+        quantity_array<length_d> c = 10 * meter - a;
+        quantity_array<area_d  > d = ( a + meter ) * a;
+
+        EXPECT( b[2] ==  3 * meter );
+        EXPECT( c[2] ==  6 * meter );
+        EXPECT( d[2] == 20 * meter * meter );
+    },
+
+    "quantity_expression compound assignment to span", []
+    {
+        quantity_array<length_d> a( 18, 1 * meter );
+        quantity_array<speed_d > v( 18, 1 * meter / second );
+
+        a.span().subspan( 2, 16 ) += v.span().subspan( 2, 16 ) * ( 2 * second );
+        a.span().subspan( 0,  2 ).assign( 7 * meter );
+
+        EXPECT( a[ 0] == 7 * meter );
+        EXPECT( a[17] == 3 * meter );
+    },
+
+    "eval() turns an expression into an array", []
+    {
+        quantity_array<speed_d        > v( 6, 5 * meter / second );
+        quantity_array<time_interval_d> t( 6, 2 * second );
+
+        auto x = eval( v * t );
+
+        EXPECT( x.size() == 6u );
+        EXPECT( x[5] == 10 * meter );
+    },
+};
+
+const lest::test views[] =
+{
+    "quantity has the layout of its magnitude", []
+    {
+        EXPECT( ( detail::has_magnitude_layout<length_d, double>::value ) );
+        EXPECT( ( detail::has_magnitude_layout<length_d, float >::value ) );
+        EXPECT( ( detail::has_magnitude_layout<length_d, int   >::value ) );
+    },
+
+    "quantity_span views a raw buffer without copying", []
+    {
+        double buffer[] = { 1, 2, 3, 4 };
+
+        quantity_span<length_d> s( detail::magnitude_tag, buffer, 4 );
+
+        EXPECT( s.size() == 4u );
+        EXPECT( s[3] == 4 * meter );
+
+        s[0] = 5 * meter;
+
+        EXPECT( buffer[0] == 5 );
+    },
+
+    "as_quantities() views a const raw buffer read-only", []
+    {
+        const float buffer[] = { 1, 2, 3 };
+
+        auto s = as_quantities<time_interval_d>( buffer, 3 );
+
+        EXPECT( ( std::is_same< decltype( s ), quantity_span<time_interval_d, float const> >::value ) );
+        EXPECT( s[2] == 3 * second );
+        EXPECT( static_cast<void const *>( s.data() ) == buffer );
+    },
+
+    "magnitudes() views quantities as raw magnitudes without copying", []
+    {
+        quantity_array<length_d> a( 3, 2 * meter );
+
+        auto m = as_magnitudes( a );
+
+        EXPECT( m.size() == 3u );
+        EXPECT( m[2] == 2.0 );
+
+        m[1] = 7;
+
+        EXPECT( a[1] == 7 * meter );
+        EXPECT( a.span().magnitudes().data() == m.data() );
+    },
+
+    "raw views combine with expressions", []
+    {
+        double x[] = { 1, 2, 3 };
+        double v[] = { 1, 1, 1 };
+
+        auto xs = as_quantities<length_d>( x, 3 );
+
+        xs += as_quantities<speed_d>( v, 3 ) * ( 2 * second );
+
+        EXPECT( x[0] == 3 );
+        EXPECT( x[2] == 5 );
+    },
+};
+
+const lest::test conversion[] =
+{
+    "convert() expresses all elements in a given unit", []
+    {
+        quantity_array<length_d> a( 35, 3 * mile );
+        std::vector<double> miles( a.size() );
+
+        convert( a, mile, magnitude_span<double>( miles.data(), miles.size() ) );
+
+        EXPECT( s( miles[ 0] ) == "3.000000" );
+        EXPECT( s( miles[34] ) == "3.000000" );
+        EXPECT( s( miles[34] ) == s( a[34].to( mile ) ) );
+    },
+
+    "convert() converts a read-only span to another magnitude type", []
+    {
+        quantity_array<energy_d> e{ 1 * btu_it, 2 * btu_it, kilo * joule };
+        float out[3] = {};
+
+        convert( e.span().subspan( 0, 2 ), btu_it, magnitude_span<float>( out, 2 ) );
+
+        EXPECT( s( out[0] ) == "1.000000" );
+        EXPECT( s( out[1] ) == "2.000000" );
+        EXPECT( out[2] == 0 );
+    },
+
+    "convert() converts in place", []
+    {
+        quantity_array<length_d> a( 20, 2 * kilo * meter );
+
+        auto m = convert( a, meter / 1000 );
+
+        EXPECT( m.data() == a.magnitudes().data() );
+        EXPECT( s( m[19] ) == "2000000.000000" );
+    },
+
+    "convert() divides integer magnitudes", []
+    {
+        quantity<length_d, int> const ten_m( detail::magnitude_tag, 10 );
+        quantity_array<length_d, int> a( 17, 3 * ten_m );
+
+        auto m = convert( a, ten_m );
+
+        EXPECT( m[16] == 3 );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( construction )
+    + lest::run( arithmetic )
+    + lest::run( expressions )
+    + lest::run( views )
+    + lest::run( conversion )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_array.exe test_quantity_array.cpp && test_quantity_array.exe
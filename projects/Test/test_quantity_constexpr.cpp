@@ -0,0 +1,147 @@
+/**
+ * \file test_quantity_constexpr.cpp
+ *
+ * \brief   lest tests for compile-time math and tables of quantities.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_constexpr.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+// relative difference of a compile-time and a run-time result:
+
+template< typename X >
+X rel( X const x, X const y )
+{
+    return std::abs( x - y ) / std::abs( y );
+}
+
+// diagonals of a 3D grid with a cell size of 5 um, and plasma frequencies:
+
+constexpr quantity<length_d> diagonal( std::size_t const i )
+{
+    return cx::sqrt( Rep( 3 * i * i ) ) * 5 * micro * meter;
+}
+
+constexpr quantity<frequency_d> plasma_frequency( std::size_t const i )
+{
+    return cx::sqrt( Rep( 1e24 ) * ( i + 1 ) * cube( 1 / meter ) * square( 1.602176634e-19 * coulomb )
+        / ( 8.8541878128e-12 * farad / meter * 9.1093837015e-31 * kilogram ) );
+}
+
+constexpr auto diagonals   = make_table<64>( diagonal );
+constexpr auto frequencies = make_table< 8>( plasma_frequency );
+
+const lest::test compile_time[] =
+{
+    "cx::sqrt() and cx::cbrt() are compile-time constants", []
+    {
+        static_assert( cx::sqrt( 16 * square( meter ) ) == 4 * meter, "" );
+        static_assert( cx::cbrt( 27 * cube( meter ) ) == 3 * meter, "" );
+        static_assert( cx::cbrt( -8.0 ) == -2, "" );
+        static_assert( cx::sqrt( 0.0 ) == 0, "" );
+        static_assert( cx::sqrt( 1e-300 ) > 0, "" );
+
+        EXPECT( rel( cx::sqrt( 2.0 ), std::sqrt( 2.0 ) ) < 1e-15 );
+        EXPECT( rel( cx::cbrt( 2.0 ), std::cbrt( 2.0 ) ) < 1e-15 );
+        EXPECT( rel( cx::sqrt( 1e300 ), std::sqrt( 1e300 ) ) < 1e-15 );
+        EXPECT( rel( cx::sqrt( 3e-310 ), std::sqrt( 3e-310 ) ) < 1e-15 );
+        EXPECT( rel( cx::cbrt( 7e-200 ), std::cbrt( 7e-200 ) ) < 1e-15 );
+        EXPECT( rel( cx::sqrt( 2.0f ), std::sqrt( 2.0f ) ) == 0 );
+    },
+
+    "cx::nth_root() has the dimensions of nth_root()", []
+    {
+        constexpr auto r = cx::nth_root<4>( 81 * nth_power<4>( meter ) );
+        constexpr auto q = cx::nth_root<-2>( 4 * square( meter ) );
+
+        static_assert( r == 3 * meter, "" );
+        static_assert( q == 0.5 / meter, "" );
+        static_assert( cx::nth_root<5>( 32.0 ) == 2, "" );
+        static_assert( cx::nth_root<5>( -32.0 ) == -2, "" );
+
+        EXPECT( ( std::is_same< decltype( q ), decltype( nth_root<-2>( square( meter ) ) ) const >::value ) );
+        EXPECT( rel( cx::nth_root<7>( 10.0 ), std::pow( 10.0, 1.0 / 7 ) ) < 1e-15 );
+    },
+
+    "cx::sqrt() of integral magnitudes is rounded", []
+    {
+        constexpr quantity<area_d, long> a( detail::magnitude_tag, 10 );
+
+        static_assert( cx::sqrt( a ).magnitude() == 3, "" );
+        static_assert( cx::sqrt( 16 ) == 4, "" );
+        static_assert( cx::cbrt( 26 ) == 3, "" );
+    },
+
+    "cx::exp() and cx::log() of numbers", []
+    {
+        static_assert( cx::exp( 0.0 ) == 1, "" );
+        static_assert( cx::log( 1.0 ) == 0, "" );
+
+        for ( double x : { -700.0, -30.5, -1.0, -1e-9, 0.3, 1.0, 2.5, 88.7, 700.0 } )
+        {
+            EXPECT( rel( cx::exp( x ), std::exp( x ) ) < 1e-14 );
+        }
+
+        for ( double x : { 5e-324, 1e-300, 1e-5, 0.5, 0.999, 2.0, 10.0, 1e300 } )
+        {
+            EXPECT( std::abs( cx::log( x ) - std::log( x ) ) < 1e-15 * std::max( 1.0, std::abs( std::log( x ) ) ) );
+        }
+
+        EXPECT( cx::exp( 1e6 ) == std::numeric_limits<double>::infinity() );
+        EXPECT( cx::log( 0.0 ) == -std::numeric_limits<double>::infinity() );
+    },
+};
+
+const lest::test tables[] =
+{
+    "make_table() fills a std::array at compile time", []
+    {
+        static_assert( diagonals.size() == 64, "" );
+        static_assert( diagonals[0] == quantity<length_d>::zero(), "" );
+        static_assert( diagonals[1] > 5 * micro * meter, "" );
+
+        EXPECT( ( std::is_same< decltype( diagonals ), std::array< quantity<length_d>, 64 > const >::value ) );
+        EXPECT( rel( diagonals[63].magnitude(), std::sqrt( 3.0 ) * 63 * 5e-6 ) < 1e-15 );
+    },
+
+    "make_table() of plasma frequencies", []
+    {
+        static_assert( frequencies[0] < frequencies[7], "" );
+
+        EXPECT( s( frequencies[0].magnitude() / 1e13 ) == "5.641460" );
+        EXPECT( rel( frequencies[3].magnitude(), 2 * frequencies[0].magnitude() ) < 1e-15 );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( compile_time )
+    + lest::run( tables )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_constexpr.exe test_quantity_constexpr.cpp && test_quantity_constexpr.exe
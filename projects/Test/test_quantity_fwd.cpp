@@ -0,0 +1,107 @@
+/**
+ * \file test_quantity_fwd.cpp
+ *
+ * \brief   lest tests for the forward declarations and the literal-only headers.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity_fwd.hpp"
+
+// declare with the forward declarations only, define after quantity.hpp:
+
+phys::units::quantity< phys::units::energy_d >
+work( phys::units::quantity< phys::units::force_d > f, phys::units::quantity< phys::units::length_d > d );
+
+#include "phys/units/quantity_literals_joule.hpp"
+#include "phys/units/quantity_literals.hpp"
+
+#ifdef PHYS_UNITS_QUANTITY_IO_HPP_INCLUDED
+# error the literal-only headers must not include quantity_io.hpp
+#endif
+
+#include "phys/units/quantity_io_joule.hpp"
+
+#ifndef PHYS_UNITS_QUANTITY_IO_HPP_INCLUDED
+# error quantity_io_joule.hpp must include quantity_io.hpp, as it always did
+#endif
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+quantity< energy_d > work( quantity< force_d > f, quantity< length_d > d )
+{
+    return f * d;
+}
+
+const lest::test forward[] =
+{
+    "forward declared dimensions are those of quantity.hpp", []
+    {
+        EXPECT( ( std::is_same< energy_d, dimensions< 2, 1, -2, 0, 0, 0, 0 > >::value ) );
+        EXPECT( ( std::is_same< quantity< length_d >, std::decay< decltype( meter ) >::type >::value ) );
+        EXPECT( ( std::is_same< quantity< speed_d >, decltype( meter / second ) >::value ) );
+    },
+
+    "forward declared function takes and returns quantities", []
+    {
+        EXPECT( work( 2_N, 3 * meter ) == 6_J );
+    },
+};
+
+const lest::test literal_only[] =
+{
+    "literal-only header gives the literals of its unit", []
+    {
+        EXPECT( 1_kJ == 1000 * joule );
+        EXPECT( 2_mJ == 0.002 * joule );
+        EXPECT( 3.5_J == 3.5 * joule );
+    },
+
+    "literals of all derived units", []
+    {
+        EXPECT( 1_kV   == 1000 * volt );
+        EXPECT( 1_MW   == mega * watt );
+        EXPECT( 1_uF   == 1e-6 * farad );
+        EXPECT( 1_kOhm == kilo * ohm );
+        EXPECT( 1_Wb   == weber );
+        EXPECT( 1_Gy   == 1_Sv );
+        EXPECT( 1_Bq   == 1_Hz );
+    },
+
+    "unit header names the unit and gives the IO layer", []
+    {
+        EXPECT( std::string( unit_info< energy_d >::name()   ) == "joule" );
+        EXPECT( std::string( unit_info< energy_d >::symbol() ) == "J" );
+        EXPECT( io::to_string( 2_kJ ) == "2000 J" );
+        EXPECT( io::to_string( prefix( "k" ) * joule ) == "1000 J" );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( forward )
+    + lest::run( literal_only )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_fwd.exe test_quantity_fwd.cpp && test_quantity_fwd.exe
@@ -20,6 +20,8 @@
 #include "phys/units/io_symbols.hpp"
 #include "phys/units/io_output_eng.hpp"
 
+#include <clocale>
+
 #include "test_util.hpp"  // include before lest.hpp
 
 #ifndef USE_HAMLEST
@@ -32,6 +34,18 @@
 using namespace phys::units;
 using namespace phys::units::literals;
 
+// magnitude type that streams, but has no to_string():
+
+struct tenths
+{
+    int count;
+};
+
+std::ostream & operator<<( std::ostream & os, tenths const x )
+{
+    return os << x.count / 10 << '.' << x.count % 10;
+}
+
 const lest::test output[] =
 {
     "quantity output conversions", []
@@ -65,11 +79,51 @@ const lest::test output[] =
         EXPECT( os.str() == "1.23 km" );
     },
 
+    "quantity output of a magnitude type that only streams", []
+    {
+        quantity< length_d, tenths > const q( detail::magnitude_tag, tenths{ 15 } );
+
+        EXPECT( to_magnitude( q ) == "1.5" );
+        EXPECT( io::to_string( q ) == "1.5 m" );
+    },
+
     "quantity output exceptions", []
     {
         EXPECT_THROWS_AS( prefix( "x" ), prefix_error );
     },
 
+    "prefix symbols, powers of ten and factors", []
+    {
+        static_assert( prefix_exponent( "k"  ) ==  3, "" );
+        static_assert( prefix_exponent( "da" ) ==  1, "" );
+        static_assert( prefix_exponent( "d"  ) == -1, "" );
+        static_assert( prefix_exponent( "u"  ) == -6, "" );
+        static_assert( prefix_exponent( "x"  ) == detail::no_prefix, "" );
+        static_assert( prefix_exponent( ""   ) == detail::no_prefix, "" );
+        static_assert( prefix_exponent( "dam") == detail::no_prefix, "" );
+        static_assert( prefix_symbol( 0 )[0] == '\0', "" );
+        static_assert( prefix_symbol( 4 ) == nullptr, "" );
+
+        for ( int exponent = -24; exponent <= 24; ++exponent )
+        {
+            if ( char const * const symbol = prefix_symbol( exponent ) )
+            {
+                if ( exponent != 0 )
+                {
+                    EXPECT( prefix_exponent( symbol ) == exponent );
+                    EXPECT( std::abs( prefix( symbol ) / std::pow( 10.0, exponent ) - 1 ) < 1e-15 );
+                }
+            }
+        }
+
+        EXPECT( prefix( "da" ) == 10 );
+        EXPECT( prefix( std::string( "M" ) ) == 1e6 );
+        EXPECT( prefix( "m" ) == Rep( milli ) );
+        EXPECT( std::string( prefix_symbol( -6 ) ) == "u" );
+        EXPECT_THROWS_AS( prefix( "" ), prefix_error );
+        EXPECT_THROWS_AS( prefix( std::string( "kk" ) ), prefix_error );
+    },
+
     "quantity base unit names", []
     {
         EXPECT( to_unit_name( meter    ) == "meter" );
@@ -161,12 +215,163 @@ const lest::test output[] =
         EXPECT( to_unit_symbol( 1_W  ) == "W" );
     },
 
+    "quantity units-and-exponents are compile-time strings", []
+    {
+        typedef dimensions< 1, 0, -2 > acceleration_d;
+
+        static_assert( sizeof( detail::unit_symbol< acceleration_d >::type::value ) == sizeof( "m s-2" ), "" );
+
+        EXPECT( std::string( unit_info< acceleration_d >::symbol() ) == "m s-2" );
+        EXPECT( std::string( unit_info< dimensions< 2, 1, -3, -3 > >::symbol() ) == "m+2 kg s-3 A-3" );
+        EXPECT( std::string( unit_info< dimensions< -3, 0, 0, 0, 0, 1, 0 > >::symbol() ) == "m-3 mol" );
+        EXPECT( std::string( unit_info< dimensions< 0, -12, 0, 0, 1, 0, 10 > >::symbol() ) == "kg-12 K cd+10" );
+        EXPECT( std::string( detail::unit_symbol< dimensionless_d >::type::value ) == "" );
+
+        EXPECT( unit_info< acceleration_d >::symbol() == unit_info< acceleration_d >::symbol() );
+        EXPECT( to_unit_symbol( 3 * meter / square( second ) ) == "m s-2" );
+        EXPECT( io::to_string( 3 * meter / square( second ) ) == "3 m s-2" );
+    },
+};
+
+// io::to_chars() into a buffer of n characters, as string:
+
+template< typename Q >
+std::string chars( Q const & q, io::chars_format const fmt = io::chars_format::general, std::size_t const n = 64 )
+{
+    char buf[ 64 ];
+
+    io::to_chars_result const r = io::to_chars( buf, buf + n, q, fmt );
+
+    return r.ec == std::errc() ? std::string( buf, r.ptr ) : "value too large";
+}
+
+// LC_NUMERIC with a decimal comma for the scope, if the system has such a locale:
+
+struct decimal_comma_locale
+{
+    decimal_comma_locale()
+    {
+        for ( char const * const name : { "de_DE.UTF-8", "de_DE.utf8", "de_DE", "German" } )
+        {
+            if ( std::setlocale( LC_NUMERIC, name ) )
+                break;
+        }
+    }
+
+    ~decimal_comma_locale()
+    {
+        std::setlocale( LC_NUMERIC, "C" );
+    }
+};
+
+const lest::test to_chars_output[] =
+{
+    "to_chars() gives what to_string() gives", []
+    {
+        for ( double x : { 0.0, -1.5, 1.0 / 3, 4700.0, 1e23, 6.02214076e23, -2e-300 } )
+        {
+            EXPECT( chars( x * meter ) == io::to_string( x * meter ) );
+            EXPECT( chars( x * joule ) == io::to_string( x * joule ) );
+            EXPECT( chars( x * meter / square( second ) ) == io::to_string( x * meter / square( second ) ) );
+        }
+    },
+
+    "to_chars() gives the shortest magnitude that reads back the same", []
+    {
+        using io::chars_format;
+
+        EXPECT( chars( 0.1 * meter,     chars_format::shortest ) == "0.1 m" );
+        EXPECT( chars( 1.0 / 3 * meter, chars_format::shortest ) == "0.3333333333333333 m" );
+        EXPECT( chars( 1e23 * meter,    chars_format::shortest ) == "1e+23 m" );
+        EXPECT( chars( 4.7_kV,          chars_format::shortest ) == "4700 V" );
+        EXPECT( chars( quantity<length_d, float>( 0.1f * meter ), chars_format::shortest ) == "0.1 m" );
+        EXPECT( chars( quantity<length_d, long double>( 0.1L * meter ), chars_format::shortest ) == "0.1 m" );
+
+        for ( double x = 1e-10; x < 1e10; x *= 1.37 )
+        {
+            std::string const s = chars( x * meter, chars_format::shortest );
+
+            EXPECT( std::strtod( s.c_str(), nullptr ) == x );
+        }
+    },
+
+    "to_chars() gives the shortest magnitude by default, also at the limits of the type", []
+    {
+        using io::chars_format;
+
+        char buf[ 64 ];
+
+        EXPECT( std::string( buf, io::to_chars( buf, buf + sizeof buf, 0.1 * meter ).ptr ) == "0.1 m" );
+
+        EXPECT( chars( 5e-324 * meter,                  chars_format::shortest ) == "5e-324 m" );
+        EXPECT( chars( 2.2250738585072014e-308 * meter, chars_format::shortest ) == "2.2250738585072014e-308 m" );
+        EXPECT( chars( 1.7976931348623157e308 * meter,  chars_format::shortest ) == "1.7976931348623157e+308 m" );
+        EXPECT( chars( -0.0001234 * meter,              chars_format::shortest ) == "-0.0001234 m" );
+        EXPECT( chars( 1.234e-5 * meter,                chars_format::shortest ) == "1.234e-05 m" );
+        EXPECT( chars( 123456789012345.0 * meter,       chars_format::shortest ) == "123456789012345 m" );
+        EXPECT( chars( 1e15 * meter,                    chars_format::shortest ) == "1e+15 m" );
+        EXPECT( chars( 0.0 * meter,                     chars_format::shortest ) == "0 m" );
+        EXPECT( chars( quantity<length_d, float>( 1e-45f * meter ), chars_format::shortest ) == "1e-45 m" );
+        EXPECT( chars( quantity<length_d, float>( 3.4028235e38f * meter ), chars_format::shortest ) == "3.4028235e+38 m" );
+
+        for ( float x = 1e-10f; x < 1e10f; x *= 1.37f )
+        {
+            std::string const s = chars( quantity<length_d, float>( x * meter ), chars_format::shortest );
+
+            EXPECT( std::strtof( s.c_str(), nullptr ) == x );
+        }
+    },
+
+    "output has a decimal point in a locale with a decimal comma", []
+    {
+        using io::chars_format;
+
+        // Grisu3 leaves this one to the fallback:
+        quantity<length_d> const x = 0.0010200079167798992 * meter;
+        quantity<length_d, long double> const y( 1.5L * meter );
+
+        decimal_comma_locale const locale;
+
+        EXPECT( chars( x, chars_format::shortest ) == "0.0010200079167798992 m" );
+        EXPECT( chars( x ) == "0.00102001 m" );
+        EXPECT( chars( y, chars_format::shortest ) == "1.5 m" );
+        EXPECT( chars( y ) == "1.5 m" );
+        EXPECT( io::to_string( x ) == "0.00102001 m" );
+        EXPECT( io::to_string( y ) == "1.5 m" );
+        EXPECT( io::eng::to_string( 1.23_km ) == "1.23 km" );
+    },
+
+    "to_chars() of integral magnitudes", []
+    {
+        EXPECT( chars( quantity<length_d, long>( detail::magnitude_tag, -42 ) ) == "-42 m" );
+        EXPECT( chars( quantity<length_d, unsigned>( detail::magnitude_tag, 42u ) ) == "42 m" );
+    },
+
+    "to_chars() reports the characters written or that they do not fit", []
+    {
+        char buf[ 8 ] = "xxxxxxx";
+
+        io::to_chars_result r = io::to_chars( buf, buf + 3, 2.5 * meter );
+
+        EXPECT( r.ptr == buf + 3 );
+        EXPECT( ( r.ec == std::errc::value_too_large ) );
+
+        r = io::to_chars( buf, buf + 5, 2.5 * meter );
+
+        EXPECT( r.ptr == buf + 5 );
+        EXPECT( ( r.ec == std::errc() ) );
+        EXPECT( std::string( buf, buf + 7 ) == "2.5 mxx" );
+
+        EXPECT( chars( 2 * meter / square( second ), io::chars_format::general, 7 ) == "2 m s-2" );
+        EXPECT( chars( 2 * meter / square( second ), io::chars_format::general, 6 ) == "value too large" );
+    },
 };
 
 int main()
 {
     const int total = 0
     + lest::run( output )
+    + lest::run( to_chars_output )
     ;
 
     if ( total )
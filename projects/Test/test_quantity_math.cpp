@@ -0,0 +1,193 @@
+/**
+ * \file test_quantity_math.cpp
+ *
+ * \brief   lest tests for dimension-aware math on quantities, spans and arrays.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_math.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+template< typename Q, typename D >
+using has_dimension = std::is_same< typename Q::dimension_type, D >;
+
+const lest::test scalar[] =
+{
+    "hypot() of quantities of equal dimensions", []
+    {
+        auto const r = hypot( 3 * meter, 4 * meter );
+
+        EXPECT( r == 5 * meter );
+        EXPECT( s( hypot( 3e200 * meter, 4e200 * meter ).magnitude() / 1e200 ) == "5.000000" );
+    },
+
+    "fma() has the dimensions of x * y + z", []
+    {
+        auto const x = fma( 2 * meter / second, 3 * second, 1 * meter );
+
+        EXPECT( ( std::is_same< decltype( x ), quantity<length_d> const >::value ) );
+        EXPECT( x == 7 * meter );
+        EXPECT( fma( 2, 3 * meter, 1 * meter ) == 7 * meter );
+        EXPECT( ( fma( 2 * meter, 1 / meter, 1.0 ) == 3 ) );
+    },
+
+    "rsqrt() has the dimensions of 1 / sqrt( x )", []
+    {
+        auto const r = rsqrt( 4 * square( meter ) );
+
+        EXPECT( ( has_dimension< decltype( r ), decltype( 1 / meter )::dimension_type >::value ) );
+        EXPECT( r == 0.5 / meter );
+        EXPECT( rsqrt( 0.25 ) == 2 );
+    },
+
+    "fast_rsqrt() approximates rsqrt()", []
+    {
+        for ( double x : { 1e-30, 1e-3, 0.7, 1.0, 2.0, 12345.0, 1e30 } )
+        {
+            double const  rd = fast_rsqrt( x ) * std::sqrt( x );
+            float  const  rf = fast_rsqrt( float( x ) ) * std::sqrt( float( x ) );
+
+            EXPECT( std::abs( rd - 1 ) < 1e-10 );
+            EXPECT( std::abs( rf - 1 ) < 1e-5f );
+        }
+
+        EXPECT( s( ( fast_rsqrt( 4 * square( meter ) ) * meter ) ) == "0.500000" );
+    },
+};
+
+const lest::test elementwise[] =
+{
+    "hypot() of spans has the dimension of the spans", []
+    {
+        quantity_array<length_d> x = { 3 * meter, 5 * meter };
+        quantity_array<length_d> y = { 4 * meter, 12 * meter };
+        quantity_array<length_d> r( 2 );
+
+        r.span().assign( hypot( x.span(), y ) );
+
+        EXPECT( r[0] == 5 * meter );
+        EXPECT( r[1] == 13 * meter );
+    },
+
+    "sqrt(), square() and abs() of arrays", []
+    {
+        quantity_array<area_d> a( 40, 9 * square( meter ) );
+        quantity_array<length_d> x = sqrt( a );
+
+        EXPECT( x[39] == 3 * meter );
+        EXPECT( eval( square( -x ) )[0] == 9 * square( meter ) );
+        EXPECT( eval( abs( -x ) )[0] == 3 * meter );
+    },
+
+    "rsqrt() and fast_rsqrt() of arrays", []
+    {
+        quantity_array<area_d, float> a( 40, quantity<area_d, float>( detail::magnitude_tag, 4.0f ) );
+
+        auto const r = eval( rsqrt( a ) );
+        auto const f = eval( fast_rsqrt( a ) );
+
+        EXPECT( ( std::is_same< decltype( r )::value_type, quantity< decltype( 1 / meter )::dimension_type, float > >::value ) );
+        EXPECT( r[0].magnitude() == 0.5f );
+        EXPECT( std::abs( f[39].magnitude() - 0.5f ) < 1e-5f );
+    },
+
+    "fma() of ranges and scalars has the dimensions of x * y + z", []
+    {
+        quantity_array<speed_d> v( 20, 2 * meter / second );
+        quantity_array<length_d> x0( 20, 1 * meter );
+        quantity_array<length_d> x( 20 );
+
+        x = fma( v, 3 * second, x0 );
+
+        EXPECT( x[0] == 7 * meter );
+        EXPECT( x[19] == 7 * meter );
+
+        x = fma( 2, x0, 1 * meter );
+
+        EXPECT( x[19] == 3 * meter );
+
+        x = fma( v, 3 * second, fma( x0, 2, x0 ) );
+
+        EXPECT( x[19] == 9 * meter );
+        EXPECT( ( std::is_same< decltype( fma( v, 3 * second, x0 ) )::value_type, quantity<length_d> >::value ) );
+    },
+
+    "exp(), log() and trigonometric functions of dimensionless ranges", []
+    {
+        quantity<time_interval_d> const tau = 2 * second;
+        quantity_array<time_interval_d> t = { 0 * second, 2 * second, 4 * second };
+        quantity_array<length_d> x( 3 );
+
+        x = 3 * meter * exp( -t / tau );
+
+        EXPECT( x[0] == 3 * meter );
+        EXPECT( s( x[1] ) == s( 3 * std::exp( -1.0 ) * meter ) );
+        EXPECT( s( x[2] ) == s( 3 * std::exp( -2.0 ) * meter ) );
+
+        x = tau / second * meter * log( t / tau + 1 );
+
+        EXPECT( x[0] == 0 * meter );
+        EXPECT( s( x[2] ) == s( 2 * std::log( 3.0 ) * meter ) );
+
+        quantity<angular_velocity_d> const w = 0.5 / second;
+
+        x = meter * ( square( sin( w * t ) ) + square( cos( w * t ) ) );
+
+        EXPECT( s( x[1] ) == s( meter ) );
+        EXPECT( s( x[2] ) == s( meter ) );
+
+        x = meter * tan( w * t );
+
+        EXPECT( s( x[2] ) == s( std::tan( 2.0 ) * meter ) );
+        EXPECT( !( detail::is_dimensionless_range< quantity_array<length_d> >::value ) );
+        EXPECT(  ( detail::is_dimensionless_range< decltype( t / tau ) >::value ) );
+    },
+
+    "Lorentz factor of an array of momenta", []
+    {
+        typedef decltype( kilogram * meter / second ) momentum;
+
+        quantity<mass_d> const m = 9.1093837015e-31 * kilogram;
+        quantity<speed_d> const c = 299792458 * meter / second;
+
+        quantity_array<momentum::dimension_type> p( 20, m * c );
+        quantity_array<speed_d> v( 20 );
+
+        v = p / ( m * sqrt( 1 + square( p / ( m * c ) ) ) );
+
+        EXPECT( s( v[0] / c ) == s( 1 / std::sqrt( 2.0 ) ) );
+        EXPECT( s( v[19] / c ) == s( 1 / std::sqrt( 2.0 ) ) );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( scalar )
+    + lest::run( elementwise )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_math.exe test_quantity_math.cpp && test_quantity_math.exe
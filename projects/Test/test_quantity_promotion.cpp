@@ -0,0 +1,118 @@
+/**
+ * \file test_quantity_promotion.cpp
+ *
+ * \brief   lest tests for the type-promotion policies of quantity arithmetic.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// the policy applies to the whole translation unit:
+
+#define PHYS_UNITS_PROMOTION_POLICY keep_left
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_array.hpp"
+#include "phys/units/scaled_quantity.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+#include "lest.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+template< typename Q, typename T >
+using has_rep = std::is_same< typename Q::value_type, T >;
+
+const lest::test policies[] =
+{
+    "promotion::natural follows the built-in operators", []
+    {
+        EXPECT( ( std::is_same< promotion::natural::mul<float, long double>, long double >::value ) );
+        EXPECT( ( std::is_same< promotion::natural::add<int  , double     >, double      >::value ) );
+    },
+
+    "promotion::keep_left keeps the type of the quantity", []
+    {
+        EXPECT( ( std::is_same< promotion::keep_left::mul<float, long double>, float >::value ) );
+        EXPECT( ( std::is_same< promotion::keep_left::add<float, double     >, float >::value ) );
+    },
+
+    "promotion::at_most_rep limits floating point to Rep", []
+    {
+        EXPECT( ( std::is_same< promotion::at_most_rep::mul<float, long double>, Rep   >::value ) );
+        EXPECT( ( std::is_same< promotion::at_most_rep::mul<float, float      >, float >::value ) );
+        EXPECT( ( std::is_same< promotion::at_most_rep::mul<int  , int        >, int   >::value ) );
+    },
+};
+
+const lest::test keep_left[] =
+{
+    "quantity<D, float> stays float when scaled by a prefix", []
+    {
+        quantity<length_d, float> const x( detail::magnitude_tag, 2.0f );
+
+        EXPECT( ( has_rep< decltype( x * kilo  ), float >::value ) );
+        EXPECT( ( has_rep< decltype( kilo * x  ), float >::value ) );
+        EXPECT( ( has_rep< decltype( x / milli ), float >::value ) );
+        EXPECT( ( x * kilo ).magnitude() == 2000.0f );
+    },
+
+    "quantity<D, float> stays float with double quantities", []
+    {
+        quantity<length_d, float> x( detail::magnitude_tag, 2.0f );
+        quantity<time_interval_d, float> const t( detail::magnitude_tag, 4.0f );
+
+        EXPECT( ( has_rep< decltype( x + meter ), float >::value ) );
+        EXPECT( ( has_rep< decltype( x / second ), float >::value ) );
+        EXPECT( ( std::is_same< decltype( 1 / t ), quantity<frequency_d, float> >::value ) );
+        EXPECT( ( std::is_same< decltype( meter / t ), quantity<speed_d, double> >::value ) );
+
+        x += meter;
+        x *= milli;
+
+        EXPECT( x.magnitude() == 0.003f );
+    },
+
+    "quantity_array of float stays float", []
+    {
+        quantity_array<length_d, float> a( 20, quantity<length_d, float>( detail::magnitude_tag, 1.0f ) );
+
+        auto e = a * kilo + meter;
+
+        EXPECT( ( std::is_same< decltype( e )::value_type, quantity<length_d, float> >::value ) );
+        EXPECT( e[19].magnitude() == 1001.0f );
+    },
+
+    "scaled_quantity of float stays float", []
+    {
+        scaled_quantity<length_d, std::milli, float> const x( detail::magnitude_tag, 2.0f );
+
+        EXPECT( ( has_rep< decltype( x * kilo ), float >::value ) );
+        EXPECT( ( has_rep< decltype( kilo * x ), float >::value ) );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( policies )
+    + lest::run( keep_left )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_quantity_promotion.exe test_quantity_promotion.cpp && test_quantity_promotion.exe
@@ -0,0 +1,400 @@
+/**
+ * \file test_scaled_quantity.cpp
+ *
+ * \brief   lest tests for quantities with a compile-time scale.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/scaled_quantity.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+// define to_string(scaled_quantity<>) before inclusion of lest.hpp:
+
+namespace lest {
+
+template< typename D, typename R, typename T >
+std::string to_string( ::phys::units::scaled_quantity<D,R,T> const & q )
+{
+    std::ostringstream os;
+    os << to_string( q.dimension() ) << "(" << q.magnitude() << " * " << R::num << "/" << R::den << ")";
+    return os.str();
+}
+
+} // namespace lest
+
+#include "lest.hpp"
+
+#include <cstdint>
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+typedef scaled_quantity< length_d, std::micro > micrometers;
+typedef scaled_quantity< length_d, std::milli > millimeters;
+typedef scaled_quantity< length_d, std::kilo  > kilometers;
+typedef scaled_quantity< time_interval_d, std::nano > nanoseconds;
+
+typedef scaled_quantity< length_d, std::micro, long > micrometers_i;
+typedef scaled_quantity< length_d, std::milli, long > millimeters_i;
+
+// 16.16 fixed-point number as a user-defined magnitude type; like such types
+// usually are, it is implicitly constructed from numbers and explicitly
+// converted to floating point:
+
+class fix16
+{
+public:
+    constexpr fix16() : raw( 0 ) { }
+
+    template< typename I, typename = typename std::enable_if< std::is_integral<I>::value >::type >
+    constexpr fix16( I const x ) : raw( std::int32_t( x * one ) ) { }
+
+    constexpr fix16( double const x ) : raw( std::int32_t( x * one + ( x < 0 ? -0.5 : 0.5 ) ) ) { }
+
+    explicit constexpr operator double() const { return double( raw ) / one; }
+    explicit constexpr operator long double() const { return ( long double )( raw ) / one; }
+
+    static constexpr fix16 from_raw( std::int32_t const r ) { return fix16( r, raw_tag() ); }
+
+    friend constexpr fix16 operator-( fix16 x ) { return from_raw( -x.raw ); }
+    friend constexpr fix16 operator+( fix16 x, fix16 y ) { return from_raw( x.raw + y.raw ); }
+    friend constexpr fix16 operator-( fix16 x, fix16 y ) { return from_raw( x.raw - y.raw ); }
+    friend constexpr fix16 operator*( fix16 x, fix16 y ) { return from_raw( std::int32_t( std::int64_t( x.raw ) * y.raw / one ) ); }
+    friend constexpr fix16 operator/( fix16 x, fix16 y ) { return from_raw( std::int32_t( std::int64_t( x.raw ) * one / y.raw ) ); }
+
+    fix16 & operator+=( fix16 y ) { return *this = *this + y; }
+    fix16 & operator-=( fix16 y ) { return *this = *this - y; }
+    fix16 & operator*=( fix16 y ) { return *this = *this * y; }
+    fix16 & operator/=( fix16 y ) { return *this = *this / y; }
+
+    friend constexpr bool operator==( fix16 x, fix16 y ) { return x.raw == y.raw; }
+    friend constexpr bool operator!=( fix16 x, fix16 y ) { return x.raw != y.raw; }
+    friend constexpr bool operator< ( fix16 x, fix16 y ) { return x.raw <  y.raw; }
+    friend constexpr bool operator<=( fix16 x, fix16 y ) { return x.raw <= y.raw; }
+    friend constexpr bool operator> ( fix16 x, fix16 y ) { return x.raw >  y.raw; }
+    friend constexpr bool operator>=( fix16 x, fix16 y ) { return x.raw >= y.raw; }
+
+    friend std::ostream & operator<<( std::ostream & os, fix16 x ) { return os << double( x ); }
+
+private:
+    enum { one = 65536 };
+
+    struct raw_tag { };
+
+    constexpr fix16( std::int32_t const r, raw_tag ) : raw( r ) { }
+
+    std::int32_t raw;
+};
+
+namespace std {
+
+template<>
+struct numeric_limits< fix16 >
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_integer = false;
+
+    static constexpr fix16 max()    { return fix16::from_raw( INT32_MAX ); }
+    static constexpr fix16 lowest() { return fix16::from_raw( INT32_MIN ); }
+};
+
+} // namespace std
+
+typedef scaled_quantity< length_d, std::micro, fix16 > micrometers_f;
+typedef scaled_quantity< length_d, std::milli, fix16 > millimeters_f;
+
+const lest::test construction[] =
+{
+    "scaled_quantity can be default-constructed, magnitude is zero", []
+    {
+        micrometers x;
+
+        EXPECT( x.magnitude() == 0 );
+        EXPECT( x == micrometers::zero() );
+    },
+
+    "scaled_quantity can be constructed from a magnitude in its scale", []
+    {
+        micrometers x( detail::magnitude_tag, 3 );
+
+        EXPECT( x.magnitude() == 3 );
+        EXPECT( x.dimension() == length_d() );
+    },
+
+    "scaled_quantity can be constructed from a quantity", []
+    {
+        millimeters x = 2 * meter;
+
+        EXPECT( s( x.magnitude() ) == "2000.000000" );
+    },
+
+    "scaled_quantity converts to a quantity", []
+    {
+        kilometers x( detail::magnitude_tag, 3 );
+
+        quantity<length_d> q = x;
+
+        EXPECT( q == 3000 * meter );
+        EXPECT( x.to_quantity() == 3000 * meter );
+    },
+
+    "scaled_quantity converts between scales", []
+    {
+        kilometers  x( detail::magnitude_tag, 2 );
+        millimeters y = x;
+
+        EXPECT( y.magnitude() == 2e6 );
+        EXPECT( scale_cast<kilometers>( y ) == x );
+    },
+
+    "scaled_quantity conversion folds to a compile-time constant", []
+    {
+        static_assert( millimeters( kilometers( detail::magnitude_tag, 2 ) ).magnitude() == 2e6, "" );
+        static_assert( millimeters( millimeters( detail::magnitude_tag, 7 ) ).magnitude() == 7, "" );
+
+        EXPECT( true );
+    },
+
+    "scaled_quantity conversion of integers is exact", []
+    {
+        millimeters_i x( detail::magnitude_tag, 1234 );
+        micrometers_i y = x;
+
+        EXPECT( y.magnitude() == 1234000 );
+        EXPECT( millimeters_i( y ).magnitude() == 1234 );
+    },
+
+    "scaled_quantity conversion that truncates is explicit", []
+    {
+        EXPECT( ( std::is_convertible< millimeters_i, micrometers_i >::value ) );
+        EXPECT( ( std::is_convertible< quantity<length_d, long>, micrometers_i >::value ) );
+
+        EXPECT( !( std::is_convertible< micrometers_i, millimeters_i >::value ) );
+        EXPECT( !( std::is_convertible< micrometers, micrometers_i >::value ) );
+        EXPECT( !( std::is_convertible< quantity<length_d>, micrometers_i >::value ) );
+
+        EXPECT( ( std::is_constructible< millimeters_i, micrometers_i >::value ) );
+        EXPECT( ( std::is_convertible< micrometers_i, millimeters >::value ) );
+    },
+
+    "scaled_quantity conversion from floating point to integer rounds", []
+    {
+        EXPECT( micrometers_i( 1.5e-6 * meter ).magnitude() == 2 );
+        EXPECT( micrometers_i( -1.4e-6 * meter ).magnitude() == -1 );
+        EXPECT( micrometers_i( 0.001 * meter ).magnitude() == 1000 );
+    },
+
+    "scaled_quantity integer to quantity uses Rep if needed", []
+    {
+        typedef scaled_quantity< length_d, std::kilo, long > kilometers_i;
+
+        EXPECT( ( std::is_same< micrometers_i::si_value_type, Rep  >::value ) );
+        EXPECT( ( std::is_same< kilometers_i ::si_value_type, long >::value ) );
+
+        EXPECT( e( micrometers_i( detail::magnitude_tag, 5 ).to_quantity().magnitude() ) == e( 5e-6 ) );
+        EXPECT( kilometers_i ( detail::magnitude_tag, 5 ).to_quantity().magnitude() == 5000 );
+    },
+
+    "checked_scale_cast() detects overflow", []
+    {
+        typedef scaled_quantity< time_interval_d, std::nano, std::int32_t > nanoseconds_32;
+        typedef scaled_quantity< time_interval_d, std::ratio<1>, std::int32_t > seconds_32;
+
+        EXPECT( checked_scale_cast<nanoseconds_32>( seconds_32( detail::magnitude_tag, 2 ) ).magnitude() == 2000000000 );
+        EXPECT_THROWS_AS( checked_scale_cast<nanoseconds_32>( seconds_32( detail::magnitude_tag, 3 ) ).magnitude() == 0, std::overflow_error );
+    },
+
+    "checked_scale_cast() checks the value it converts, as rounded in its computation", []
+    {
+        typedef scaled_quantity< length_d, std::ratio<3>, double > triple_meters;
+        typedef scaled_quantity< length_d, std::ratio<1>, std::int64_t > meters_64;
+        typedef scaled_quantity< length_d, std::milli, std::int64_t > millimeters_64;
+
+        // 3 x ( 2^63 - 2048 ) / 3 is exact; 3 x ( 2^63 - 512 ) / 3 rounds to 2^63 in double:
+
+        EXPECT( checked_scale_cast<meters_64>( triple_meters( detail::magnitude_tag, 3074457345618257920.0 ) ).magnitude() == INT64_C( 9223372036854773760 ) );
+        EXPECT( checked_scale_cast<meters_64>( triple_meters( detail::magnitude_tag, -3074457345618258432.0 ) ).magnitude() == INT64_MIN );
+        EXPECT_THROWS_AS( checked_scale_cast<meters_64>( triple_meters( detail::magnitude_tag, 3074457345618258432.0 ) ).magnitude() == 0, std::overflow_error );
+
+        EXPECT( checked_scale_cast<millimeters_64>( meters_64( detail::magnitude_tag, INT64_MAX / 1000 ) ).magnitude() == INT64_MAX / 1000 * 1000 );
+        EXPECT_THROWS_AS( checked_scale_cast<millimeters_64>( meters_64( detail::magnitude_tag, INT64_MAX / 1000 + 1 ) ).magnitude() == 0, std::overflow_error );
+        EXPECT_THROWS_AS( checked_scale_cast<millimeters_64>( meters_64( detail::magnitude_tag, INT64_MIN / 1000 - 1 ) ).magnitude() == 0, std::overflow_error );
+    },
+};
+
+const lest::test arithmetic[] =
+{
+    "scaled_quantity addition and subtraction keep the scale", []
+    {
+        micrometers a( detail::magnitude_tag, 3 );
+        micrometers b( detail::magnitude_tag, 2 );
+
+        EXPECT( ( a + b ).magnitude() == 5 );
+        EXPECT( ( a - b ).magnitude() == 1 );
+        EXPECT( ( -a ).magnitude() == -3 );
+        EXPECT( ( +a ).magnitude() ==  3 );
+
+        a += b; EXPECT( a.magnitude() == 5 );
+        a -= b; EXPECT( a.magnitude() == 3 );
+    },
+
+    "scaled_quantity can be scaled by a number", []
+    {
+        micrometers a( detail::magnitude_tag, 6 );
+
+        EXPECT( ( a * 2 ).magnitude() == 12 );
+        EXPECT( ( 2 * a ).magnitude() == 12 );
+        EXPECT( ( a / 3 ).magnitude() ==  2 );
+
+        a *= 2; EXPECT( a.magnitude() == 12 );
+        a /= 4; EXPECT( a.magnitude() ==  3 );
+    },
+
+    "scaled_quantity product and quotient combine the scales", []
+    {
+        micrometers x( detail::magnitude_tag, 6 );
+        nanoseconds t( detail::magnitude_tag, 2 );
+
+        auto v = x / t;
+        auto a = x * x;
+
+        EXPECT( v.magnitude() == 3 );
+        EXPECT( v.to_quantity() == 3000 * meter / second );
+        EXPECT( ( std::is_same< decltype( v )::ratio_type, std::kilo >::value ) );
+        EXPECT( ( std::is_same< decltype( a )::dimension_type, area_d >::value ) );
+        EXPECT( s( a.to_quantity().magnitude() ) == "0.000000" );
+    },
+
+    "scaled_quantity dimensionless quotient is a number", []
+    {
+        millimeters x( detail::magnitude_tag, 3 );
+        micrometers y( detail::magnitude_tag, 1500 );
+
+        EXPECT( ( x / y == 2 ) );
+    },
+};
+
+const lest::test timestepping[] =
+{
+    "scaled_quantity integer nanosecond time steps are exact", []
+    {
+        typedef scaled_quantity< time_interval_d, std::nano, std::int64_t > nanoseconds_i;
+
+        nanoseconds_i const dt( 1e-3 * second / 3 );
+        nanoseconds_i t;
+
+        for ( int i = 0; i < 3000; ++i )
+        {
+            t += dt;
+        }
+
+        EXPECT( dt.magnitude() == 333333 );
+        EXPECT( t.magnitude() == 999999000 );
+        EXPECT( ( t / dt == 3000 ) );
+    },
+
+    "scaled_quantity integer speed from integer length and time", []
+    {
+        typedef scaled_quantity< time_interval_d, std::milli, std::int64_t > milliseconds_i;
+
+        micrometers_i  x( detail::magnitude_tag, 6000 );
+        milliseconds_i t( detail::magnitude_tag, 2 );
+
+        auto v = x / t;
+
+        EXPECT( v.magnitude() == 3000 );
+        EXPECT( v.to_quantity() == 3 * meter / second );
+    },
+};
+
+const lest::test comparison[] =
+{
+    "scaled_quantity comparison", []
+    {
+        nanoseconds a( detail::magnitude_tag, 1 );
+        nanoseconds b( detail::magnitude_tag, 2 );
+
+        EXPECT( a == a );
+        EXPECT( a != b );
+        EXPECT( a <  b );
+        EXPECT( a <= b );
+        EXPECT( b >  a );
+        EXPECT( b >= a );
+    },
+};
+
+const lest::test fixed_point[] =
+{
+    "quantity with a fixed-point magnitude promotes as the built-in operations", []
+    {
+        quantity< length_d, fix16 > const x = fix16( 1.5 ) * meter;
+
+        EXPECT( ( std::is_same< decltype( fix16( 1.5 ) * meter ), quantity< length_d, fix16 > >::value ) );
+        EXPECT( ( std::is_same< decltype( x * 2 ), quantity< length_d, fix16 > const >::value ||
+                  std::is_same< decltype( x * 2 ), quantity< length_d, fix16 > >::value ) );
+        EXPECT( ( x * 2 ).magnitude() == fix16( 3 ) );
+        EXPECT( ( x * 0.5 ).magnitude() == fix16( 0.75 ) );
+        EXPECT( ( x + x ).magnitude() == fix16( 3 ) );
+        EXPECT( ( x / fix16( 3 ) ).magnitude() == fix16( 0.5 ) );
+    },
+
+    "scaled_quantity with a fixed-point magnitude can be scaled by a fixed-point number", []
+    {
+        millimeters_f a( detail::magnitude_tag, fix16( 2.5 ) );
+
+        EXPECT( ( a * fix16( 2 ) ).magnitude() == fix16( 5 ) );
+        EXPECT( ( fix16( 2 ) * a ).magnitude() == fix16( 5 ) );
+        EXPECT( ( a / fix16( 2 ) ).magnitude() == fix16( 1.25 ) );
+        EXPECT( ( a * 2 ).magnitude() == fix16( 5 ) );
+
+        a *= fix16( 4 ); EXPECT( a.magnitude() == fix16( 10 ) );
+        a /= fix16( 8 ); EXPECT( a.magnitude() == fix16( 1.25 ) );
+    },
+
+    "scaled_quantity with a fixed-point magnitude converts between scales and to quantity", []
+    {
+        millimeters_f const a( detail::magnitude_tag, fix16( 2.5 ) );
+        micrometers_f const b = a;
+        millimeters_f const c( 0.0025 * meter );
+
+        EXPECT( b.magnitude() == fix16( 2500 ) );
+        EXPECT( c.magnitude() == fix16( 2.5 ) );
+        EXPECT( std::abs( a.to_quantity().magnitude() - 0.0025 ) < 1e-12 );
+    },
+
+    "checked_scale_cast() detects overflow of a fixed-point magnitude", []
+    {
+        EXPECT( checked_scale_cast<micrometers_f>( millimeters_f( detail::magnitude_tag, fix16( 30 ) ) ).magnitude() == fix16( 30000 ) );
+        EXPECT_THROWS_AS( checked_scale_cast<micrometers_f>( millimeters_f( detail::magnitude_tag, fix16( 40 ) ) ).magnitude() == fix16( 0 ), std::overflow_error );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( construction )
+    + lest::run( arithmetic )
+    + lest::run( timestepping )
+    + lest::run( comparison )
+    + lest::run( fixed_point )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_scaled_quantity.exe test_scaled_quantity.cpp && test_scaled_quantity.exe
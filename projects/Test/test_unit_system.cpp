@@ -0,0 +1,133 @@
+/**
+ * \file test_unit_system.cpp
+ *
+ * \brief   lest tests for quantities in normalized unit systems.
+ * \author  the PhysUnits C++11 contributors
+ * \date    17 October 2026
+ * \since   1.1
+ *
+ * Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+ * This code is provided as-is, with no warrantee of correctness.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/unit_system.hpp"
+
+#include "test_util.hpp"  // include before lest.hpp
+
+// define to_string(system_quantity<>) before inclusion of lest.hpp:
+
+namespace lest {
+
+template< typename S, typename D, typename T >
+std::string to_string( ::phys::units::system_quantity<S,D,T> const & q )
+{
+    std::ostringstream os;
+    os << to_string( q.dimension() ) << "(" << q.magnitude() << " * " << q.scale() << ")";
+    return os.str();
+}
+
+} // namespace lest
+
+#include "lest.hpp"
+
+using namespace phys::units;
+using namespace phys::units::literals;
+
+// normalized to a cell size of 5 um, a plasma period of 20 fs and the elementary charge:
+
+struct plasma_units : si_system
+{
+    static constexpr Rep length()  { return 5e-6; }
+    static constexpr Rep time()    { return 2e-14; }
+    static constexpr Rep current() { return 1.602176634e-19 / 2e-14; }
+};
+
+struct micro_units : si_system
+{
+    static constexpr Rep length()  { return 1e-6; }
+};
+
+template< typename D >
+using plasma = system_quantity< plasma_units, D, float >;
+
+const lest::test unit_system[] =
+{
+    "system_quantity scale is a compile-time constant per dimension", []
+    {
+        static_assert( plasma<length_d>::scale() == 5e-6, "" );
+        static_assert( plasma<speed_d >::scale() == 5e-6 / 2e-14, "" );
+        static_assert( system_quantity< si_system, energy_d >::scale() == 1, "" );
+
+        EXPECT( e( plasma<electric_charge_d>::scale() ) == e( 1.602176634e-19 ) );
+    },
+
+    "system_quantity converts from and to SI", []
+    {
+        plasma<length_d> x = 15 * micro * meter;
+
+        EXPECT( x.magnitude() == 3.0f );
+        EXPECT( ( std::is_same< decltype( x.to_quantity() ), quantity<length_d, double> >::value ) );
+        EXPECT( s( x.to_quantity().magnitude() ) == s( 15e-6 ) );
+        EXPECT( e( quantity<length_d>( x ).magnitude() ) == e( 15e-6 ) );
+    },
+
+    "system_quantity keeps float magnitudes near one where SI would underflow", []
+    {
+        plasma<electric_charge_d> const q = 1.602176634e-19 * coulomb;
+        plasma<length_d>          const r = 5e-6 * meter;
+
+        auto const p = q * q * r * r;   // (C m)^2, 6.4e-49 in SI
+
+        EXPECT( s( p.magnitude() ) == "1.000000" );
+        EXPECT( e( p.to_quantity().magnitude() ) == e( 6.417735e-49 ) );
+        EXPECT( e( float( p.to_quantity().magnitude() ) ) == e( 0.0f ) );
+    },
+
+    "system_quantity arithmetic needs no rescaling", []
+    {
+        plasma<length_d>        const x( detail::magnitude_tag, 6.0f );
+        plasma<time_interval_d> const t( detail::magnitude_tag, 2.0f );
+
+        auto const v = x / t;
+
+        EXPECT( ( std::is_same< decltype( v ), plasma<speed_d> const >::value ) );
+        EXPECT( v.magnitude() == 3.0f );
+        EXPECT( s( v.to_quantity().magnitude() ) == s( 3 * 5e-6 / 2e-14 ) );
+
+        EXPECT( ( x + x ).magnitude() == 12.0f );
+        EXPECT( ( x - x ) == plasma<length_d>::zero() );
+        EXPECT( ( 2 * x / 4 ).magnitude() == 3.0f );
+        EXPECT( ( x / plasma<length_d>::unit() == 6.0f ) );
+        EXPECT( x > plasma<length_d>::unit() );
+    },
+
+    "system_quantity converts between systems", []
+    {
+        auto const x = in_system<plasma_units, float>( 15 * micro * meter );
+        auto const y = system_cast<micro_units>( x );
+
+        EXPECT( ( std::is_same< decltype( y ), system_quantity<micro_units, length_d, float> const >::value ) );
+        EXPECT( y.magnitude() == 15.0f );
+        EXPECT( s( system_cast<plasma_units, double>( y ).magnitude() ) == "3.000000" );
+    },
+};
+
+int main()
+{
+    const int total = 0
+    + lest::run( unit_system )
+    ;
+
+    if ( total )
+    {
+        std::cout << "Grand total of " << total << " failed " << lest::pluralise(total, "test") << "." << std::endl;
+    }
+
+    return total;
+}
+
+// g++ -Wall -Wextra -Weffc++ -std=c++11 -I../../ -o test_unit_system.exe test_unit_system.cpp && test_unit_system.exe
@@ -33,6 +33,18 @@ std::string to_string( ::phys::units::dimensions<D1,D2,D3,D4,D5,D6,D7> const & /
     return os.str();
 }
 
+#ifdef PHYS_UNITS_PACKED_DIMENSIONS
+template< ::phys::units::detail::dimension_code Code >
+std::string to_string( ::phys::units::packed_dimensions<Code> const & /*dim*/ )
+{
+    typedef ::phys::units::packed_dimensions<Code> D;
+
+    std::ostringstream os;
+    os << "<" << D::dim1 << "," << D::dim2 << "," << D::dim3 << "," << D::dim4 << "," << D::dim5 << "," << D::dim6 << "," << D::dim7 << ">";
+    return os.str();
+}
+#endif
+
 template <typename D, typename T>
 std::string to_string( ::phys::units::quantity<D,T> const & q )
 {
@@ -49,6 +61,42 @@ operator "" _str( char const * text, std::size_t /*num_chars*/ )
     return text;
 }
 
+#ifdef PHYS_UNITS_ERASED
+
+// with dimensions erased, a quantity is its magnitude: s() gives the number
+// only and equals a text with unit symbol that starts with that number:
+
+struct number_text
+{
+    std::string text;
+};
+
+inline bool operator==( number_text const & x, std::string const & y )
+{
+    return x.text == y.substr( 0, y.find( ' ' ) );
+}
+
+inline bool operator!=( number_text const & x, std::string const & y )
+{
+    return !( x == y );
+}
+
+inline std::ostream & operator<<( std::ostream & os, number_text const & x )
+{
+    return os << x.text;
+}
+
+inline number_text
+s( phys::units::Rep v )
+{
+    std::ostringstream os;
+    os.setf( std::ios::fixed, std::ios::floatfield );
+    os << std::setprecision(6) << v;
+    return number_text{ os.str() };
+}
+
+#else
+
 inline std::string
 s( phys::units::Rep v )
 {
@@ -58,6 +106,8 @@ s( phys::units::Rep v )
     return os.str();
 }
 
+#endif // PHYS_UNITS_ERASED
+
 inline std::string
 e( phys::units::Rep v )
 {
@@ -0,0 +1,91 @@
+//
+// time_alloc.cpp - performance measurement for allocate-then-fill of quantity buffers
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program sizes a buffer of n quantities and overwrites all elements,
+// as a particle code does with a fresh buffer, and reports the throughput
+// in GB/s of the element data. std::vector and quantity_array zero the
+// elements first; with no_init_allocator and quantity_array( n, no_init )
+// the fill is the only pass over the memory. An uninitialized new double[n]
+// is the reference.
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_allocator.hpp"
+#include "phys/units/quantity_array.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace phys::units;
+using namespace std;
+
+const size_t n = 32 * 1024 * 1024; // elements, 256 MB of double
+const int    k = 5;                // repetitions - make it bigger for faster machines
+
+typedef chrono::steady_clock clock_type;
+
+double check = 0;
+
+template< typename Buffer, typename Make >
+double gb_per_sec( Make make )
+{
+    auto t0 = clock_type::now();
+
+    for ( int j = 0; j < k; ++j )
+    {
+        Buffer buf = make();
+        auto const data = &buf[0];
+
+        for ( size_t i = 0; i < n; ++i )
+        {
+            data[i] = Rep( i ) * meter;
+        }
+        check += magnitude( data[n / 2] );
+    }
+
+    auto t1 = clock_type::now();
+
+    return 1e-9 * k * n * sizeof( Rep ) / chrono::duration<double>( t1 - t0 ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    (void) argc;
+    cout << argv[0] << ": Performance test of allocate-then-fill of quantity buffers." << endl;
+
+    typedef quantity<length_d> length;
+
+    // doubles viewed as quantities, as quantity_span does:
+
+    struct raw_buffer
+    {
+        unique_ptr<double[]> p;
+        length & operator[]( size_t i ) { return reinterpret_cast<length *>( p.get() )[i]; }
+    };
+
+    const double tr = gb_per_sec< raw_buffer                                   >( []{ return raw_buffer{ unique_ptr<double[]>( new double[n] ) }; } );
+    const double tv = gb_per_sec< vector<length>                               >( []{ return vector<length>( n ); } );
+    const double tn = gb_per_sec< vector<length, no_init_allocator<length> >   >( []{ return vector<length, no_init_allocator<length> >( n ); } );
+    const double ta = gb_per_sec< quantity_array<length_d>                     >( []{ return quantity_array<length_d>( n ); } );
+    const double tu = gb_per_sec< quantity_array<length_d>                     >( []{ return quantity_array<length_d>( n, no_init ); } );
+
+    cout << setprecision( 3 );
+    cout << "new double[n]                      = " << tr << " GB/s  (1)" << endl;
+    cout << "vector<quantity>(n)                = " << tv << " GB/s  (" << tv/tr << ")" << endl;
+    cout << "vector<quantity, no_init_alloc>(n) = " << tn << " GB/s  (" << tn/tr << ")" << endl;
+    cout << "quantity_array(n)                  = " << ta << " GB/s  (" << ta/tr << ")" << endl;
+    cout << "quantity_array(n, no_init)         = " << tu << " GB/s  (" << tu/tr << ")" << endl;
+
+    cout << "check = " << check << endl << endl;
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+//
+// time_array.cpp - performance measurement for quantity arrays
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program compares element-wise updates of quantity arrays with the
+// same updates written as loops over plain arrays of double.
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_array.hpp"
+#include "phys/units/other_units.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <time.h>
+
+using namespace phys::units;
+using namespace std;
+
+const int n = 10000000; // elements
+const int k = 20;       // repetitions - make it bigger for faster machines
+
+void double_update( double * x, double const * v, int const n )
+{
+    for ( int i = 0; i < n; ++i )
+    {
+        x[i] += v[i];
+    }
+}
+
+void double_kinematics( double * x, double const * x0, double const * v, double const * a, double const dt, int const n )
+{
+    for ( int i = 0; i < n; ++i )
+    {
+        x[i] = x0[i] + v[i] * dt + 0.5 * a[i] * dt * dt;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    (void) argc;
+    cout << argv[0] << ": Performance test of quantity_array." << endl;
+
+    unique_ptr<double[]> xd ( new double[n]() );
+    unique_ptr<double[]> x0d( new double[n]() );
+    unique_ptr<double[]> vd ( new double[n]() );
+    unique_ptr<double[]> ad ( new double[n]() );
+
+    for ( int i = 0; i < n; ++i ) { vd[i] = 1; ad[i] = 2; }
+
+    quantity_array<length_d      > xq ( n );
+    quantity_array<length_d      > x0q( n );
+    quantity_array<speed_d       > vq ( n, 1 * meter / second );
+    quantity_array<acceleration_d> aq ( n, 2 * meter / square( second ) );
+
+    const quantity<time_interval_d> dt = 1 * second;
+
+    // x += v; x += a;
+
+    clock_t t0 = clock();
+
+    for ( int j = 0; j < k; ++j )
+    {
+        double_update( xd.get(), vd.get(), n );
+        double_update( xd.get(), ad.get(), n );
+    }
+
+    clock_t t1 = clock();
+
+    for ( int j = 0; j < k; ++j )
+    {
+        xq += vq * dt;
+        xq += aq * dt * dt;
+    }
+
+    clock_t t2 = clock();
+
+    // x = x0 + v * dt + 0.5 * a * dt * dt;
+
+    for ( int j = 0; j < k; ++j )
+    {
+        double_kinematics( xd.get(), x0d.get(), vd.get(), ad.get(), dt.magnitude(), n );
+    }
+
+    clock_t t3 = clock();
+
+    for ( int j = 0; j < k; ++j )
+    {
+        xq = x0q + vq * dt + 0.5 * aq * dt * dt;
+    }
+
+    clock_t t4 = clock();
+
+    // export in miles: q.to( mile ) per element versus convert()
+
+    for ( int j = 0; j < k; ++j )
+    {
+        for ( int i = 0; i < n; ++i )
+        {
+            xd[i] = xq[i].to( mile );
+        }
+    }
+
+    clock_t t5 = clock();
+
+    for ( int j = 0; j < k; ++j )
+    {
+        convert( xq, mile, magnitude_span<double>( xd.get(), n ) );
+    }
+
+    clock_t t6 = clock();
+
+    const double cps = CLOCKS_PER_SEC;
+    const double tdu = 1e3 * (t1-t0)/cps/k;
+    const double tqu = 1e3 * (t2-t1)/cps/k;
+    const double tdk = 1e3 * (t3-t2)/cps/k;
+    const double tqk = 1e3 * (t4-t3)/cps/k;
+    const double tto = 1e3 * (t5-t4)/cps/k;
+    const double tcv = 1e3 * (t6-t5)/cps/k;
+
+    cout << std::setprecision( 3 );
+    cout << "one double update       = " << tdu << " msec  (1)" << endl;
+    cout << "one quantity update     = " << tqu << " msec  (" << tqu/tdu << ")" << endl;
+    cout << "one double kinematics   = " << tdk << " msec  (1)" << endl;
+    cout << "one quantity kinematics = " << tqk << " msec  (" << tqk/tdk << ")" << endl;
+    cout << "one element-wise to()   = " << tto << " msec  (1)" << endl;
+    cout << "one bulk convert()      = " << tcv << " msec  (" << tcv/tto << ")" << endl;
+
+    cout << "x = " << xd[n-1] << ", " << xq[n-1].magnitude() << endl << endl;
+
+    return 0;
+}
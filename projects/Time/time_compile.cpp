@@ -0,0 +1,106 @@
+//
+// time_compile.cpp - compile-time measurement for code with many derived quantities
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program is not meant to be run, but to be compiled: 'make time_compile'
+// in projects/gcc/Time compiles it with quantities and, with -DTIME_COMPILE_RAW,
+// with plain doubles. Each of the TIME_COMPILE_STEPS (300) steps computes a
+// dozen expressions over its own set of derived dimensions, as a simulation
+// with many physical formulas does.
+
+#ifndef TIME_COMPILE_STEPS
+# define TIME_COMPILE_STEPS 300
+#endif
+
+#ifdef TIME_COMPILE_RAW
+
+#include <cmath>
+
+typedef double Rep;
+
+constexpr Rep meter    = 1;
+constexpr Rep kilogram = 1;
+constexpr Rep second   = 1;
+constexpr Rep ampere   = 1;
+
+constexpr Rep power( Rep const x, int const n )
+{
+    return n == 0 ? 1 : n < 0 ? 1 / power( x, -n ) : x * power( x, n - 1 );
+}
+
+template< int N >
+constexpr Rep nth_power( Rep const x ) { return power( x, N ); }
+
+constexpr Rep square( Rep const x ) { return x * x; }
+
+constexpr Rep magnitude( Rep const x ) { return x; }
+
+using std::sqrt;
+
+#else
+
+#include "phys/units/quantity.hpp"
+
+using namespace phys::units;
+
+#endif
+
+#include <cstddef>
+#include <iostream>
+
+template< int I >
+Rep step( Rep const v )
+{
+    auto const l = v * nth_power< I % 3 + 1 >( meter );
+    auto const m = v * nth_power< I % 4 + 1 >( kilogram );
+    auto const t = v * nth_power< I % 5 - 2 >( second );
+    auto const i = v * nth_power< I % 7 - 3 >( ampere );
+
+    auto const a = l * m / ( t * t );
+    auto const b = a * t / m + l / t;
+    auto const c = b * b * m / 2 + a * l;
+    auto const p = c / t - a * b;
+    auto const q = i * t;
+    auto const u = p / i;
+    auto const r = u / i;
+    auto const s = sqrt( square( b ) ) + b;
+
+    return c / ( l * a ) + u * q / ( p * t ) + ( r < 2 * r ) + ( s > b ) + magnitude( s * t );
+}
+
+template< std::size_t... I >
+struct indices { };
+
+template< std::size_t N, std::size_t... I >
+struct make_indices : make_indices< N - 1, N - 1, I... > { };
+
+template< std::size_t... I >
+struct make_indices< 0, I...> { typedef indices<I...> type; };
+
+template< std::size_t... I >
+Rep run( Rep const v, indices<I...> )
+{
+    Rep const r[] = { step<I>( v )... };
+
+    Rep sum = 0;
+
+    for ( Rep x : r )
+    {
+        sum += x;
+    }
+    return sum;
+}
+
+int main()
+{
+    std::cout << run( 1.5, make_indices< TIME_COMPILE_STEPS >::type() ) << std::endl;
+}
+
+// cl -nologo -W3 -EHsc -I../../ time_compile.cpp
+// g++ -Wall -Wextra -std=c++11 -I../../ -c time_compile.cpp
@@ -0,0 +1,86 @@
+//
+// time_prefix.cpp - performance measurement for the lookup of SI prefixes
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program reports the number of prefix lookups per second of prefix(),
+// of prefix_exponent(), and of a std::map built per call, as prefix() did
+// before, for a mix of prefix symbols such as tagged telemetry carries.
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace phys::units;
+
+const int n = 10000000; // lookups - make it bigger for faster machines
+
+char const * const symbols[] = { "k", "M", "m", "u", "n", "da", "G", "c", "p", "h", "T", "d", };
+
+const int symbol_count = sizeof symbols / sizeof symbols[0];
+
+Rep map_prefix( std::string const prefix_ )
+{
+    std::map<std::string, Rep> table
+    {
+        { "m", milli }, { "k", kilo  }, { "u", micro }, { "M", mega  }, { "n", nano  },
+        { "G", giga  }, { "p", pico  }, { "T", tera  }, { "f", femto }, { "P", peta  },
+        { "a", atto  }, { "E", exa   }, { "z", zepto }, { "Z", zetta }, { "y", yocto },
+        { "Y", yotta }, { "h", hecto }, { "da", deka }, { "d", deci  }, { "c", centi },
+    };
+
+    auto pos = table.find( prefix_ );
+
+    if ( pos == table.end() )
+    {
+        throw prefix_error( "quantity: unrecognized prefix '" + prefix_ + "'" );
+    }
+
+    return pos->second;
+}
+
+template< typename F >
+double lookups_per_sec( F f, double & sum, int const count )
+{
+    auto t0 = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < count; ++i )
+    {
+        sum += f( symbols[ i % symbol_count ] );
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    return count / std::chrono::duration<double>( t1 - t0 ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    (void) argc;
+    std::cout << argv[0] << ": Performance test of SI prefix lookup." << std::endl;
+
+    double s1 = 0, s2 = 0, s3 = 0;
+
+    const double tm = lookups_per_sec( []( char const * s ) { return map_prefix( s ); }, s1, n / 100 );
+    const double tp = lookups_per_sec( []( char const * s ) { return prefix( s ); }, s2, n );
+    const double te = lookups_per_sec( []( char const * s ) { return prefix_exponent( s ); }, s3, n );
+
+    std::cout << std::setprecision( 3 );
+    std::cout << "std::map per call  = " << tm << " lookups/s  (1)" << std::endl;
+    std::cout << "prefix()           = " << tp << " lookups/s  (" << tp/tm << ")" << std::endl;
+    std::cout << "prefix_exponent()  = " << te << " lookups/s  (" << te/tm << ")" << std::endl;
+
+    std::cout << "check = " << s1 * 100 << ", " << s2 << ", " << s3 << std::endl << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+//
+// time_reduce.cpp - performance measurement for reductions over quantity arrays
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program compares sum() and dot() over quantity arrays, on one thread
+// and on all hardware threads, with the same reductions written as serial
+// loops over plain arrays of double. Wall-clock time is measured, as clock()
+// adds the processor time of all threads.
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_algorithm.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+using namespace phys::units;
+using namespace std;
+
+const int n = 10000000; // elements
+const int k = 20;       // repetitions - make it bigger for faster machines
+
+double double_sum( double const * x, int const n )
+{
+    double sum = 0;
+
+    for ( int i = 0; i < n; ++i )
+    {
+        sum += x[i];
+    }
+    return sum;
+}
+
+double double_dot( double const * x, double const * y, int const n )
+{
+    double sum = 0;
+
+    for ( int i = 0; i < n; ++i )
+    {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+double msec( chrono::steady_clock::time_point const t0, chrono::steady_clock::time_point const t1 )
+{
+    return chrono::duration<double, std::milli>( t1 - t0 ).count() / k;
+}
+
+int main( int argc, char * argv[] )
+{
+    (void) argc;
+    cout << argv[0] << ": Performance test of reductions over quantity_array." << endl;
+
+    unsigned const threads = max( 1u, thread::hardware_concurrency() );
+
+    unique_ptr<double[]> fd( new double[n]() );
+    unique_ptr<double[]> xd( new double[n]() );
+
+    for ( int i = 0; i < n; ++i ) { fd[i] = 2; xd[i] = 1e-3 * ( i % 1000 ); }
+
+    quantity_array<force_d > fq( n );
+    quantity_array<length_d> xq( n );
+
+    for ( int i = 0; i < n; ++i ) { fq[i] = fd[i] * newton; xq[i] = xd[i] * meter; }
+
+    double sd = 0, dd = 0;
+    quantity<length_d> sq1, sqn;
+    quantity<energy_d> dq1, dqn;
+
+    typedef chrono::steady_clock clock;
+
+    auto t0 = clock::now();
+
+    for ( int j = 0; j < k; ++j ) { sd += double_sum( xd.get(), n ); }
+
+    auto t1 = clock::now();
+
+    for ( int j = 0; j < k; ++j ) { sq1 += sum( xq, 1 ); }
+
+    auto t2 = clock::now();
+
+    for ( int j = 0; j < k; ++j ) { sqn += sum( xq, threads ); }
+
+    auto t3 = clock::now();
+
+    for ( int j = 0; j < k; ++j ) { dd += double_dot( fd.get(), xd.get(), n ); }
+
+    auto t4 = clock::now();
+
+    for ( int j = 0; j < k; ++j ) { dq1 += dot( fq, xq, 1 ); }
+
+    auto t5 = clock::now();
+
+    for ( int j = 0; j < k; ++j ) { dqn += dot( fq, xq, threads ); }
+
+    auto t6 = clock::now();
+
+    const double tds  = msec( t0, t1 );
+    const double tqs1 = msec( t1, t2 );
+    const double tqsn = msec( t2, t3 );
+    const double tdd  = msec( t3, t4 );
+    const double tqd1 = msec( t4, t5 );
+    const double tqdn = msec( t5, t6 );
+
+    cout << std::setprecision( 3 );
+    cout << "hardware threads           = " << threads << endl;
+    cout << "one double sum loop        = " << tds  << " msec  (1)" << endl;
+    cout << "one sum(), 1 thread        = " << tqs1 << " msec  (" << tqs1/tds << ")" << endl;
+    cout << "one sum(), " << setw(2) << threads << " threads      = " << tqsn << " msec  (" << tqsn/tds << ")" << endl;
+    cout << "one double dot loop        = " << tdd  << " msec  (1)" << endl;
+    cout << "one dot(), 1 thread        = " << tqd1 << " msec  (" << tqd1/tdd << ")" << endl;
+    cout << "one dot(), " << setw(2) << threads << " threads      = " << tqdn << " msec  (" << tqdn/tdd << ")" << endl;
+
+    cout << "sum = " << sd << ", " << sq1.magnitude() << ", " << sqn.magnitude() << endl;
+    cout << "dot = " << dd << ", " << dq1.magnitude() << ", " << dqn.magnitude() << endl << endl;
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+//
+// time_to_chars.cpp - performance measurement for text output of quantities
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program formats quantities as a text exporter does and reports the
+// quantities per second and the allocations per quantity of io::operator<<
+// to a stream that discards the characters, of io::to_string(), and of
+// io::to_chars() into a buffer, in general and in shortest format.
+//
+// It fails if io::to_chars() in shortest format is not faster than operator<<.
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace phys::units;
+using namespace phys::units::io;
+
+const int n = 1000000; // quantities - make it bigger for faster machines
+
+long allocations = 0;
+
+void * operator new( std::size_t size )
+{
+    ++allocations;
+
+    if ( void * p = std::malloc( size ) )
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void operator delete( void * p ) noexcept
+{
+    std::free( p );
+}
+
+// stream buffer that discards its output:
+
+struct null_buffer : std::streambuf
+{
+    int_type overflow( int_type c ) override { return c; }
+    std::streamsize xsputn( char const *, std::streamsize n ) override { return n; }
+};
+
+typedef quantity< dimensions< 1, 0, -2 > > acceleration;
+
+template< typename F >
+double quantities_per_sec( F f, long & count, std::size_t & check )
+{
+    const long a0 = allocations;
+    auto t0 = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < n; ++i )
+    {
+        check += f( ( 9.80665 + i * 1e-4 ) * meter / square( second ) );
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    count = allocations - a0;
+
+    return n / std::chrono::duration<double>( t1 - t0 ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    (void) argc;
+    std::cout << argv[0] << ": Performance test of text output of quantities." << std::endl;
+
+    null_buffer buf;
+    std::ostream os( &buf );
+    char chars[ 64 ];
+
+    long as = 0, at = 0, ag = 0, ah = 0;
+    std::size_t check = 0;
+
+    const double ts = quantities_per_sec( [&]( acceleration const & q ) { os << q; return std::size_t( 1 ); }, as, check );
+    const double tt = quantities_per_sec( [ ]( acceleration const & q ) { return to_string( q ).size(); }, at, check );
+    const double tg = quantities_per_sec( [&]( acceleration const & q ) { return std::size_t( to_chars( chars, chars + sizeof chars, q, chars_format::general ).ptr - chars ); }, ag, check );
+    const double th = quantities_per_sec( [&]( acceleration const & q ) { return std::size_t( to_chars( chars, chars + sizeof chars, q, chars_format::shortest ).ptr - chars ); }, ah, check );
+
+    std::cout << std::setprecision( 3 );
+    std::cout << "operator<<           = " << ts << " quantities/s, " << double( as ) / n << " allocations per quantity  (1)" << std::endl;
+    std::cout << "to_string()          = " << tt << " quantities/s, " << double( at ) / n << " allocations per quantity  (" << tt/ts << ")" << std::endl;
+    std::cout << "to_chars(), general  = " << tg << " quantities/s, " << double( ag ) / n << " allocations per quantity  (" << tg/ts << ")" << std::endl;
+    std::cout << "to_chars(), shortest = " << th << " quantities/s, " << double( ah ) / n << " allocations per quantity  (" << th/ts << ")" << std::endl;
+
+    std::cout << "check = " << check << std::endl << std::endl;
+
+    if ( th <= ts )
+    {
+        std::cout << "to_chars() in shortest format is not faster than operator<<" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+//
+// time_unit_symbol.cpp - performance measurement for stream output of quantities
+//
+// Copyright 2026 the PhysUnits C++11 contributors. All rights reserved.
+//
+// This code is provided as-is, with no warrantee of correctness.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This program streams quantities with a unit symbol made of units and
+// exponents to a stream that discards the characters, and reports the
+// quantities per second and the allocations per quantity, for the unit
+// symbol built on each output, as unit_info did before, and for the unit
+// symbol generated at compile time.
+
+#include "phys/units/quantity.hpp"
+#include "phys/units/quantity_io.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace phys::units;
+using namespace phys::units::io;
+
+const int n = 1000000; // quantities - make it bigger for faster machines
+
+long allocations = 0;
+
+void * operator new( std::size_t size )
+{
+    ++allocations;
+
+    if ( void * p = std::malloc( size ) )
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void operator delete( void * p ) noexcept
+{
+    std::free( p );
+}
+
+// stream buffer that discards its output:
+
+struct null_buffer : std::streambuf
+{
+    int_type overflow( int_type c ) override { return c; }
+    std::streamsize xsputn( char const *, std::streamsize n ) override { return n; }
+};
+
+// the unit symbol as unit_info<Dims>::symbol() built it before:
+
+void emit_dim( std::string & os, const char * label, int exp, bool & first )
+{
+    if( exp == 0 )
+        return;
+
+    if ( first )
+        first = false;
+    else
+        os += " ";
+
+    os += label;
+
+    if( exp > 1 )
+        os += "+";
+
+    if( exp != 1 )
+        os += std::to_string( exp );
+}
+
+template< typename Dims >
+std::string runtime_symbol()
+{
+    std::string os;
+
+    bool first = true;
+
+    emit_dim( os, "m",   Dims::dim1, first );
+    emit_dim( os, "kg",  Dims::dim2, first );
+    emit_dim( os, "s",   Dims::dim3, first );
+    emit_dim( os, "A",   Dims::dim4, first );
+    emit_dim( os, "K",   Dims::dim5, first );
+    emit_dim( os, "mol", Dims::dim6, first );
+    emit_dim( os, "cd",  Dims::dim7, first );
+
+    return os;
+}
+
+template< typename F >
+double quantities_per_sec( F f, long & count )
+{
+    null_buffer buf;
+    std::ostream os( &buf );
+
+    const long a0 = allocations;
+    auto t0 = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < n; ++i )
+    {
+        f( os, Rep( i ) * meter * meter * kilogram * kelvin * candela / cube( second ) / cube( ampere ) / mole );
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    count = allocations - a0;
+
+    return n / std::chrono::duration<double>( t1 - t0 ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    (void) argc;
+    std::cout << argv[0] << ": Performance test of stream output of quantities." << std::endl;
+
+    typedef dimensions< 2, 1, -3, -3, 1, -1, 1 > Dims;
+
+    long ar = 0, ac = 0;
+
+    const double tr = quantities_per_sec( []( std::ostream & os, quantity<Dims> const & q ) { os << q.magnitude() << " " << runtime_symbol<Dims>(); }, ar );
+    const double tc = quantities_per_sec( []( std::ostream & os, quantity<Dims> const & q ) { os << q; }, ac );
+
+    std::cout << "unit = " << unit_info<Dims>::symbol() << std::endl;
+    std::cout << std::setprecision( 3 );
+    std::cout << "symbol per output  = " << tr << " quantities/s, " << double( ar ) / n << " allocations per quantity  (1)" << std::endl;
+    std::cout << "compile-time       = " << tc << " quantities/s, " << double( ac ) / n << " allocations per quantity  (" << tc/tr << ")" << std::endl << std::endl;
+
+    return 0;
+}